@@ -0,0 +1,425 @@
+#include "curve25519.h"
+#include <string.h>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+// --- 128 λм ---
+
+#define MASK51 ((1ULL << 51) - 1)
+
+#if defined(__SIZEOF_INT128__)
+typedef unsigned __int128 W128;
+
+static inline W128 w_mul(uint64 a, uint64 b) {
+    return (W128)a * b;
+}
+
+// acc += a * b
+static inline void w_mac(W128* acc, uint64 a, uint64 b) {
+    *acc += (W128)a * b;
+}
+
+static inline void w_add64(W128* acc, uint64 a) {
+    *acc += a;
+}
+
+static inline uint64 w_lo(W128 x) {
+    return (uint64)x;
+}
+
+// (x >> 51)÷֤ 64 λ
+static inline uint64 w_shr51(W128 x) {
+    return (uint64)(x >> 51);
+}
+#else
+typedef struct {
+    uint64 lo, hi;
+} W128;
+
+static inline W128 w_mul(uint64 a, uint64 b) {
+    W128 r;
+#if defined(_MSC_VER) && defined(_M_X64)
+    r.lo = _umul128(a, b, &r.hi);
+#else
+    uint64 a_lo = (uint32)a, a_hi = a >> 32;
+    uint64 b_lo = (uint32)b, b_hi = b >> 32;
+    uint64 p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo, p3 = a_hi * b_hi;
+    uint64 mid = (p0 >> 32) + (uint32)p1 + (uint32)p2;
+    r.hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+    r.lo = (mid << 32) | (uint32)p0;
+#endif
+    return r;
+}
+
+// acc += a * b
+static inline void w_mac(W128* acc, uint64 a, uint64 b) {
+    W128 t = w_mul(a, b);
+    acc->lo += t.lo;
+    acc->hi += t.hi + (acc->lo < t.lo);
+}
+
+static inline void w_add64(W128* acc, uint64 a) {
+    acc->lo += a;
+    acc->hi += (acc->lo < a);
+}
+
+static inline uint64 w_lo(W128 x) {
+    return x.lo;
+}
+
+// (x >> 51)÷֤ 64 λ
+static inline uint64 w_shr51(W128 x) {
+    return (x.lo >> 51) | (x.hi << 13);
+}
+#endif
+
+// 5  128 λкнλ 51 λ limbλĽλ 19 ۻλ (2^255 = 19 mod p)
+static inline void carry_wide(FE25519* r, W128 t[5]) {
+    uint64 c;
+    r->v[0] = w_lo(t[0]) & MASK51; c = w_shr51(t[0]); w_add64(&t[1], c);
+    r->v[1] = w_lo(t[1]) & MASK51; c = w_shr51(t[1]); w_add64(&t[2], c);
+    r->v[2] = w_lo(t[2]) & MASK51; c = w_shr51(t[2]); w_add64(&t[3], c);
+    r->v[3] = w_lo(t[3]) & MASK51; c = w_shr51(t[3]); w_add64(&t[4], c);
+    r->v[4] = w_lo(t[4]) & MASK51; c = w_shr51(t[4]);
+    r->v[0] += c * 19;
+    r->v[1] += r->v[0] >> 51;
+    r->v[0] &= MASK51;
+}
+
+// 64 λ limb λ (ȫԼ)
+static inline void carry_limbs(FE25519* r) {
+    uint64 c;
+    c = r->v[0] >> 51; r->v[0] &= MASK51; r->v[1] += c;
+    c = r->v[1] >> 51; r->v[1] &= MASK51; r->v[2] += c;
+    c = r->v[2] >> 51; r->v[2] &= MASK51; r->v[3] += c;
+    c = r->v[3] >> 51; r->v[3] &= MASK51; r->v[4] += c;
+    c = r->v[4] >> 51; r->v[4] &= MASK51; r->v[0] += c * 19;
+}
+
+static inline uint64 load64_le(const uint8* p) {
+    uint64 r = 0;
+    for (int i = 7; i >= 0; i--) r = (r << 8) | p[i];
+    return r;
+}
+
+// --- 1.  ---
+
+void fe25519_zero(FE25519* r) {
+    memset(r, 0, sizeof(FE25519));
+}
+
+void fe25519_one(FE25519* r) {
+    memset(r, 0, sizeof(FE25519));
+    r->v[0] = 1;
+}
+
+void fe25519_from_bytes(FE25519* r, const uint8 in[32]) {
+    r->v[0] = load64_le(in) & MASK51;
+    r->v[1] = (load64_le(in + 6) >> 3) & MASK51;
+    r->v[2] = (load64_le(in + 12) >> 6) & MASK51;
+    r->v[3] = (load64_le(in + 19) >> 1) & MASK51;
+    r->v[4] = (load64_le(in + 24) >> 12) & MASK51;
+}
+
+void fe25519_to_bytes(uint8 out[32], const FE25519* a) {
+    FE25519 t = *a;
+    carry_limbs(&t);
+    carry_limbs(&t);
+
+    // ʱ t < 2^255 + Сq = 1 ҽ t >= pt - q*p  t + 19q ȥ 255 λ
+    uint64 q = (t.v[0] + 19) >> 51;
+    q = (t.v[1] + q) >> 51;
+    q = (t.v[2] + q) >> 51;
+    q = (t.v[3] + q) >> 51;
+    q = (t.v[4] + q) >> 51;
+    t.v[0] += 19 * q;
+    for (int i = 0; i < 4; i++) {
+        t.v[i + 1] += t.v[i] >> 51;
+        t.v[i] &= MASK51;
+    }
+    t.v[4] &= MASK51;   //  255 λȥ q * 2^255
+
+    uint64 w0 = t.v[0] | (t.v[1] << 51);
+    uint64 w1 = (t.v[1] >> 13) | (t.v[2] << 38);
+    uint64 w2 = (t.v[2] >> 26) | (t.v[3] << 25);
+    uint64 w3 = (t.v[3] >> 39) | (t.v[4] << 12);
+    const uint64 w[4] = { w0, w1, w2, w3 };
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 8; j++) out[8 * i + j] = (uint8)(w[i] >> (8 * j));
+    }
+}
+
+void fe25519_add(FE25519* r, const FE25519* a, const FE25519* b) {
+    for (int i = 0; i < 5; i++) r->v[i] = a->v[i] + b->v[i];
+}
+
+// r = a + 4p - bb  limb  2^53 ʱ
+void fe25519_sub(FE25519* r, const FE25519* a, const FE25519* b) {
+    r->v[0] = a->v[0] + 0x1FFFFFFFFFFFB4ULL - b->v[0];
+    for (int i = 1; i < 5; i++) r->v[i] = a->v[i] + 0x1FFFFFFFFFFFFCULL - b->v[i];
+    carry_limbs(r);
+}
+
+void fe25519_mul(FE25519* r, const FE25519* a, const FE25519* b) {
+    const uint64 a0 = a->v[0], a1 = a->v[1], a2 = a->v[2], a3 = a->v[3], a4 = a->v[4];
+    const uint64 b0 = b->v[0], b1 = b->v[1], b2 = b->v[2], b3 = b->v[3], b4 = b->v[4];
+    const uint64 b1_19 = b1 * 19, b2_19 = b2 * 19, b3_19 = b3 * 19, b4_19 = b4 * 19;
+
+    W128 t[5];
+    t[0] = w_mul(a0, b0); w_mac(&t[0], a1, b4_19); w_mac(&t[0], a2, b3_19); w_mac(&t[0], a3, b2_19); w_mac(&t[0], a4, b1_19);
+    t[1] = w_mul(a0, b1); w_mac(&t[1], a1, b0); w_mac(&t[1], a2, b4_19); w_mac(&t[1], a3, b3_19); w_mac(&t[1], a4, b2_19);
+    t[2] = w_mul(a0, b2); w_mac(&t[2], a1, b1); w_mac(&t[2], a2, b0); w_mac(&t[2], a3, b4_19); w_mac(&t[2], a4, b3_19);
+    t[3] = w_mul(a0, b3); w_mac(&t[3], a1, b2); w_mac(&t[3], a2, b1); w_mac(&t[3], a3, b0); w_mac(&t[3], a4, b4_19);
+    t[4] = w_mul(a0, b4); w_mac(&t[4], a1, b3); w_mac(&t[4], a2, b2); w_mac(&t[4], a3, b1); w_mac(&t[4], a4, b0);
+    carry_wide(r, t);
+}
+
+// ƽ: ϲΪ 2 * a_i * a_j 15 γ˷ (˷Ϊ 25 )
+void fe25519_sqr(FE25519* r, const FE25519* a) {
+    const uint64 a0 = a->v[0], a1 = a->v[1], a2 = a->v[2], a3 = a->v[3], a4 = a->v[4];
+    const uint64 d0 = a0 * 2, d1 = a1 * 2, d2 = a2 * 2 * 19, d3 = a3 * 19, d4 = a4 * 19;
+
+    W128 t[5];
+    t[0] = w_mul(a0, a0); w_mac(&t[0], d1, d4); w_mac(&t[0], d2, a3);
+    t[1] = w_mul(d0, a1); w_mac(&t[1], a2 * 2, d4); w_mac(&t[1], a3, d3);
+    t[2] = w_mul(d0, a2); w_mac(&t[2], a1, a1); w_mac(&t[2], a3 * 2, d4);
+    t[3] = w_mul(d0, a3); w_mac(&t[3], d1, a2); w_mac(&t[3], a4, d4);
+    t[4] = w_mul(d0, a4); w_mac(&t[4], d1, a3); w_mac(&t[4], a2, a2);
+    carry_wide(r, t);
+}
+
+void fe25519_mul_small(FE25519* r, const FE25519* a, uint32 b) {
+    W128 t[5];
+    for (int i = 0; i < 5; i++) t[i] = w_mul(a->v[i], b);
+    carry_wide(r, t);
+}
+
+// r = a^(2^n)
+static inline void fe_sqr_n(FE25519* r, const FE25519* a, int n) {
+    fe25519_sqr(r, a);
+    for (int i = 1; i < n; i++) fe25519_sqr(r, r);
+}
+
+// a^(p-2)p - 2 = 2^255 - 21: 254 ƽ + 11 γ˷ļӷ
+void fe25519_inv(FE25519* r, const FE25519* a) {
+    FE25519 z2, z9, z11, z_5_0, z_10_0, z_20_0, z_50_0, z_100_0, t;
+    fe25519_sqr(&z2, a);                    // a^2
+    fe_sqr_n(&t, &z2, 2);                   // a^8
+    fe25519_mul(&z9, &t, a);                // a^9
+    fe25519_mul(&z11, &z9, &z2);            // a^11
+    fe25519_sqr(&t, &z11);                  // a^22
+    fe25519_mul(&z_5_0, &t, &z9);           // a^(2^5 - 1)
+    fe_sqr_n(&t, &z_5_0, 5);
+    fe25519_mul(&z_10_0, &t, &z_5_0);       // a^(2^10 - 1)
+    fe_sqr_n(&t, &z_10_0, 10);
+    fe25519_mul(&z_20_0, &t, &z_10_0);      // a^(2^20 - 1)
+    fe_sqr_n(&t, &z_20_0, 20);
+    fe25519_mul(&t, &t, &z_20_0);           // a^(2^40 - 1)
+    fe_sqr_n(&t, &t, 10);
+    fe25519_mul(&z_50_0, &t, &z_10_0);      // a^(2^50 - 1)
+    fe_sqr_n(&t, &z_50_0, 50);
+    fe25519_mul(&z_100_0, &t, &z_50_0);     // a^(2^100 - 1)
+    fe_sqr_n(&t, &z_100_0, 100);
+    fe25519_mul(&t, &t, &z_100_0);          // a^(2^200 - 1)
+    fe_sqr_n(&t, &t, 50);
+    fe25519_mul(&t, &t, &z_50_0);           // a^(2^250 - 1)
+    fe_sqr_n(&t, &t, 5);
+    fe25519_mul(r, &t, &z11);               // a^(2^255 - 21)
+}
+
+// a^(2^252 - 3):  fe25519_inv ǰμӷ ( a^(2^250 - 1))
+void fe25519_pow22523(FE25519* r, const FE25519* a) {
+    FE25519 z2, z9, z11, z_5_0, z_10_0, z_20_0, z_50_0, z_100_0, t;
+    fe25519_sqr(&z2, a);
+    fe_sqr_n(&t, &z2, 2);
+    fe25519_mul(&z9, &t, a);
+    fe25519_mul(&z11, &z9, &z2);
+    fe25519_sqr(&t, &z11);
+    fe25519_mul(&z_5_0, &t, &z9);
+    fe_sqr_n(&t, &z_5_0, 5);
+    fe25519_mul(&z_10_0, &t, &z_5_0);
+    fe_sqr_n(&t, &z_10_0, 10);
+    fe25519_mul(&z_20_0, &t, &z_10_0);
+    fe_sqr_n(&t, &z_20_0, 20);
+    fe25519_mul(&t, &t, &z_20_0);
+    fe_sqr_n(&t, &t, 10);
+    fe25519_mul(&z_50_0, &t, &z_10_0);
+    fe_sqr_n(&t, &z_50_0, 50);
+    fe25519_mul(&z_100_0, &t, &z_50_0);
+    fe_sqr_n(&t, &z_100_0, 100);
+    fe25519_mul(&t, &t, &z_100_0);
+    fe_sqr_n(&t, &t, 50);
+    fe25519_mul(&t, &t, &z_50_0);           // a^(2^250 - 1)
+    fe_sqr_n(&t, &t, 2);
+    fe25519_mul(r, &t, a);                  // a^(2^252 - 3)
+}
+
+void fe25519_neg(FE25519* r, const FE25519* a) {
+    FE25519 zero;
+    fe25519_zero(&zero);
+    fe25519_sub(r, &zero, a);
+}
+
+void fe25519_cswap(FE25519* a, FE25519* b, uint64 swap) {
+    uint64 mask = 0 - swap;
+    for (int i = 0; i < 5; i++) {
+        uint64 x = mask & (a->v[i] ^ b->v[i]);
+        a->v[i] ^= x;
+        b->v[i] ^= x;
+    }
+}
+
+void fe25519_cmov(FE25519* r, const FE25519* a, uint64 move) {
+    uint64 mask = 0 - move;
+    for (int i = 0; i < 5; i++) r->v[i] ^= mask & (r->v[i] ^ a->v[i]);
+}
+
+// --- 2. X25519 ---
+
+// (A - 2) / 4A = 486662 Ϊ Montgomery  v^2 = u^3 + A u^2 + u ϵ
+#define X25519_A24 121665
+
+// ӿÿһκϲ
+#define X25519_BATCH_BLOCK 32
+
+static const uint8 X25519_BASE_U[X25519_KEY_SIZE] = { 9 };
+
+// RFC 7748  Montgomery ݣӰ (X : Z)
+// ۱λ 0  1 ִͬУֻ cswap 벻ͬ
+static void x25519_ladder(FE25519* X, FE25519* Z, const uint8 scalar[X25519_KEY_SIZE], const FE25519* u) {
+    uint8 k[X25519_KEY_SIZE];
+    memcpy(k, scalar, X25519_KEY_SIZE);
+    k[0] &= 248;
+    k[31] &= 127;
+    k[31] |= 64;
+
+    FE25519 x2, z2, x3, z3, A, AA, B, BB, E, C, D, DA, CB;
+    fe25519_one(&x2);
+    fe25519_zero(&z2);
+    x3 = *u;
+    fe25519_one(&z3);
+
+    uint64 swap = 0;
+    for (int t = 254; t >= 0; t--) {
+        uint64 bit = (k[t >> 3] >> (t & 7)) & 1;
+        swap ^= bit;
+        fe25519_cswap(&x2, &x3, swap);
+        fe25519_cswap(&z2, &z3, swap);
+        swap = bit;
+
+        fe25519_add(&A, &x2, &z2);
+        fe25519_sqr(&AA, &A);
+        fe25519_sub(&B, &x2, &z2);
+        fe25519_sqr(&BB, &B);
+        fe25519_sub(&E, &AA, &BB);
+        fe25519_add(&C, &x3, &z3);
+        fe25519_sub(&D, &x3, &z3);
+        fe25519_mul(&DA, &D, &A);
+        fe25519_mul(&CB, &C, &B);
+
+        fe25519_add(&x3, &DA, &CB);
+        fe25519_sqr(&x3, &x3);
+        fe25519_sub(&z3, &DA, &CB);
+        fe25519_sqr(&z3, &z3);
+        fe25519_mul(&z3, &z3, u);
+        fe25519_mul(&x2, &AA, &BB);
+        fe25519_mul_small(&z2, &E, X25519_A24);
+        fe25519_add(&z2, &z2, &AA);
+        fe25519_mul(&z2, &z2, &E);
+    }
+    fe25519_cswap(&x2, &x3, swap);
+    fe25519_cswap(&z2, &z3, swap);
+    *X = x2;
+    *Z = z2;
+    memset(k, 0, sizeof(k));
+}
+
+// ʱж 32 ֽǷȫΪ 0
+static bool is_all_zero(const uint8 in[X25519_KEY_SIZE]) {
+    uint8 acc = 0;
+    for (int i = 0; i < X25519_KEY_SIZE; i++) acc |= in[i];
+    return acc == 0;
+}
+
+bool x25519(uint8 out[X25519_KEY_SIZE], const uint8 scalar[X25519_KEY_SIZE], const uint8 u[X25519_KEY_SIZE]) {
+    FE25519 fu, X, Z;
+    fe25519_from_bytes(&fu, u);
+    x25519_ladder(&X, &Z, scalar, &fu);
+    fe25519_inv(&Z, &Z);
+    fe25519_mul(&X, &X, &Z);
+    fe25519_to_bytes(out, &X);
+    return !is_all_zero(out);
+}
+
+void x25519_public_key(uint8 pub[X25519_KEY_SIZE], const uint8 scalar[X25519_KEY_SIZE]) {
+    x25519(pub, scalar, X25519_BASE_U);
+}
+
+typedef struct {
+    uint8* out;
+    const uint8* scalars;
+    const uint8* us;        // NULL ʾ
+    bool* ok;
+} X25519_BATCH_JOB;
+
+// ÿ X25519_BATCH_BLOCK : ܽݣٶ Z һ Montgomery 
+static void x25519_batch_range(size_t begin, size_t end, void* arg) {
+    X25519_BATCH_JOB* job = (X25519_BATCH_JOB*)arg;
+    FE25519 X[X25519_BATCH_BLOCK], Z[X25519_BATCH_BLOCK], prefix[X25519_BATCH_BLOCK];
+    bool zero[X25519_BATCH_BLOCK];
+
+    for (size_t start = begin; start < end; start += X25519_BATCH_BLOCK) {
+        size_t n = end - start < X25519_BATCH_BLOCK ? end - start : X25519_BATCH_BLOCK;
+        FE25519 acc, fu;
+        fe25519_one(&acc);
+        for (size_t j = 0; j < n; j++) {
+            size_t i = start + j;
+            fe25519_from_bytes(&fu, job->us ? job->us + i * X25519_KEY_SIZE : X25519_BASE_U);
+            x25519_ladder(&X[j], &Z[j], job->scalars + i * X25519_KEY_SIZE, &fu);
+
+            // Z = 0 (С׵) ˻ֱ 0Z ֻ u֧й¶˽Կ
+            uint8 zb[X25519_KEY_SIZE];
+            fe25519_to_bytes(zb, &Z[j]);
+            zero[j] = is_all_zero(zb);
+            prefix[j] = acc;
+            if (!zero[j]) fe25519_mul(&acc, &acc, &Z[j]);
+        }
+
+        FE25519 inv, z_inv;
+        fe25519_inv(&inv, &acc);
+        for (size_t j = n; j-- > 0;) {
+            size_t i = start + j;
+            uint8* out = job->out + i * X25519_KEY_SIZE;
+            if (zero[j]) {
+                memset(out, 0, X25519_KEY_SIZE);
+            }
+            else {
+                fe25519_mul(&z_inv, &inv, &prefix[j]);
+                fe25519_mul(&inv, &inv, &Z[j]);
+                fe25519_mul(&X[j], &X[j], &z_inv);
+                fe25519_to_bytes(out, &X[j]);
+            }
+            job->ok[i] = !is_all_zero(out);
+        }
+    }
+}
+
+size_t x25519_batch(uint8* out, const uint8* scalars, const uint8* us, bool* ok, size_t count, int num_threads) {
+    if (count == 0) return 0;
+    bool* flags = ok ? ok : new bool[count];
+
+    X25519_BATCH_JOB job;
+    job.out = out;
+    job.scalars = scalars;
+    job.us = us;
+    job.ok = flags;
+    if (count <= X25519_BATCH_BLOCK) num_threads = 1;
+    parallel_for(count, num_threads, x25519_batch_range, &job);
+
+    size_t valid = 0;
+    for (size_t i = 0; i < count; i++) valid += flags[i] ? 1 : 0;
+    if (!ok) delete[] flags;
+    return valid;
+}
\ No newline at end of file
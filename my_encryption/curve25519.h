@@ -0,0 +1,79 @@
+#ifndef CURVE25519_H
+#define CURVE25519_H
+
+#include "utils.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// GF(2^255 - 19) Ԫ: 5  51 λ limbλǰ (ֵΪ sum v[i] * 2^(51 i))
+// ӼԼlimb Գ 51 λ˷ / ƽ limb ص 51 λ
+typedef struct {
+    uint64 v[5];
+} FE25519;
+
+// X25519 ˽ԿԿ (u ) 빲ֽܵڳ
+#define X25519_KEY_SIZE 32
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // --- 1.  (кΪʱ䣬r ͬ) ---
+
+    void fe25519_zero(FE25519* r);
+    void fe25519_one(FE25519* r);
+    // 32 ֽС -> Ԫ (Ե 255 λҪ < p)
+    void fe25519_from_bytes(FE25519* r, const uint8 in[32]);
+    // Ԫ -> 32 ֽС (ȫԼ [0, p))
+    void fe25519_to_bytes(uint8 out[32], const FE25519* a);
+    void fe25519_add(FE25519* r, const FE25519* a, const FE25519* b);
+    void fe25519_sub(FE25519* r, const FE25519* a, const FE25519* b);
+    void fe25519_mul(FE25519* r, const FE25519* a, const FE25519* b);
+    void fe25519_sqr(FE25519* r, const FE25519* a);
+    // r = a * bb < 2^32 ( a24 = 121665)
+    void fe25519_mul_small(FE25519* r, const FE25519* a, uint32 b);
+    // r = a^(-1) = a^(p-2)a = 0 ʱΪ 0
+    void fe25519_inv(FE25519* r, const FE25519* a);
+    // r = a^((p-5)/8) = a^(2^252 - 3)ͬʱƽ (Ed25519 ѹ)
+    void fe25519_pow22523(FE25519* r, const FE25519* a);
+    // r = -a
+    void fe25519_neg(FE25519* r, const FE25519* a);
+    // swap = 1 ʱ abswap = 0 ʱ䣻޷֧뽻
+    void fe25519_cswap(FE25519* a, FE25519* b, uint64 swap);
+    // move = 1 ʱ r = amove = 0 ʱ r 䣻޷֧
+    void fe25519_cmov(FE25519* r, const FE25519* a, uint64 move);
+
+    // --- 2. X25519 (RFC 7748) ---
+
+    /**
+     *  out = X25519(scalar, u)
+     *  RFC 7748 ü (clamp)ʹ x-only Montgomery ݣ
+     * ÿһλ̶һβּӷһα㣬ɣִ·޹
+     * @param scalar: 32 ֽ˽Կ (С)
+     * @param u: ԷԿ u  (С)
+     * @return: Ϊȫ 0 (ԷС׵) ʱ falseʱӦʹøù
+     */
+    bool x25519(uint8 out[X25519_KEY_SIZE], const uint8 scalar[X25519_KEY_SIZE], const uint8 u[X25519_KEY_SIZE]);
+
+    // Կ = X25519(scalar, 9)
+    void x25519_public_key(uint8 pub[X25519_KEY_SIZE], const uint8 scalar[X25519_KEY_SIZE]);
+
+    /**
+     *  X25519 ()
+     * ÿڸݵõ (X : Z) Montgomery  Z ϲΪһ棬
+     * ηַ̳߳أu Ϊ NULL ʱȫԻ 9  (ɹԿ)
+     * @param out: count * 32 ֽ
+     * @param scalars: count * 32 ֽ˽Կ
+     * @param us: count * 32 ֽڶԷԿ NULL
+     * @param ok:  (Ϊ NULL) x25519 ķֵͬ
+     * @param num_threads: ʹõ߳; <= 0 ʾʹȫ
+     * @return: ɹ
+     */
+    size_t x25519_batch(uint8* out, const uint8* scalars, const uint8* us, bool* ok, size_t count, int num_threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CURVE25519_H
\ No newline at end of file
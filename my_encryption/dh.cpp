@@ -9,8 +9,8 @@ uint64 dh_generate_public_key(const DH_Context* ctx, uint64 priv_key) {
         printf("Warning: Private key is out of recommended range.\n");
     }
 
-    // ʹÿģݼ
-    return power(ctx->g, priv_key, ctx->p);
+    // Ԫ̶ʹð (g, p) Ĺ̶ֻ
+    return power_fixed_base(ctx->g, priv_key, ctx->p);
 }
 
 // 2. 㹲
@@ -24,4 +24,108 @@ uint64 dh_compute_shared_secret(const DH_Context* ctx, uint64 local_priv, uint64
 
     // ļ
     return power(remote_pub, local_priv, ctx->p);
+}
+
+// 3. 㹲
+
+// һνƽģ
+#define DH_BATCH_INTERLEAVE 4
+
+typedef struct {
+    MONT_CTX mont;
+    int window;            // ڿ (λ)
+    int bits;              // ָλ
+    const uint64* privs;
+    const uint64* pubs;
+    uint64* secrets;
+    const DH_STATUS* status;
+} DH_BATCH_JOB;
+
+// 4 ·Ĺ̶ģݣÿ·ָͬ; Ч (lanes ֮״̬ OK)  1^0 ռλ
+static void dh_power_group(const DH_BATCH_JOB* job, size_t offset, size_t k) {
+    const MONT_CTX* mont = &job->mont;
+    const int w = job->window;
+    const int size = 1 << w;
+    uint64 table[DH_BATCH_INTERLEAVE][16];
+    uint64 exps[DH_BATCH_INTERLEAVE];
+    uint64 r[DH_BATCH_INTERLEAVE];
+
+    for (int j = 0; j < DH_BATCH_INTERLEAVE; j++) {
+        bool active = (size_t)j < k && job->status[offset + j] == DH_OK;
+        exps[j] = active ? job->privs[offset + j] : 0;
+        table[j][0] = mont->one;
+        table[j][1] = mont_to(active ? job->pubs[offset + j] : 1, mont);
+    }
+    for (int d = 2; d < size; d++) {
+        for (int j = 0; j < DH_BATCH_INTERLEAVE; j++) table[j][d] = mont_mul(table[j][d - 1], table[j][1], mont);
+    }
+
+    int windows = (job->bits + w - 1) / w;
+    for (int j = 0; j < DH_BATCH_INTERLEAVE; j++) r[j] = mont->one;
+    for (int i = windows - 1; i >= 0; i--) {
+        if (i != windows - 1) {
+            for (int s = 0; s < w; s++) {
+                for (int j = 0; j < DH_BATCH_INTERLEAVE; j++) r[j] = mont_mul(r[j], r[j], mont);
+            }
+        }
+        for (int j = 0; j < DH_BATCH_INTERLEAVE; j++) {
+            uint32 d = (uint32)((exps[j] >> (i * w)) & (size - 1));
+            if (d) r[j] = mont_mul(r[j], table[j][d], mont);
+        }
+    }
+
+    for (size_t j = 0; j < k; j++) {
+        job->secrets[offset + j] = (job->status[offset + j] == DH_OK) ? mont_from(r[j], mont) : 0;
+    }
+}
+
+static void dh_batch_range(size_t begin, size_t end, void* arg) {
+    const DH_BATCH_JOB* job = (const DH_BATCH_JOB*)arg;
+    for (size_t i = begin; i < end; i += DH_BATCH_INTERLEAVE) {
+        size_t k = (end - i < DH_BATCH_INTERLEAVE) ? end - i : DH_BATCH_INTERLEAVE;
+        dh_power_group(job, i, k);
+    }
+}
+
+size_t dh_compute_shared_secret_batch(const DH_Context* ctx, const uint64* local_privs, const uint64* remote_pubs,
+                                      uint64* secrets, DH_STATUS* status, size_t count, int num_threads) {
+    if (count == 0) return 0;
+    DH_STATUS* st = status ? status : new DH_STATUS[count];
+    uint64 p = ctx->p;
+
+    // 1. У: ԿΧ˽Կ
+    size_t ok = 0;
+    uint64 max_priv = 0;
+    bool params_ok = p > 3 && (p & 1) == 1;
+    for (size_t i = 0; i < count; i++) {
+        if (!params_ok) st[i] = DH_ERR_PARAMS;
+        else if (remote_pubs[i] < 2 || remote_pubs[i] > p - 2) st[i] = DH_ERR_PUBLIC_KEY;
+        else if (local_privs[i] == 0) st[i] = DH_ERR_PRIVATE_KEY;
+        else {
+            st[i] = DH_OK;
+            ok++;
+            if (local_privs[i] > max_priv) max_priv = local_privs[i];
+        }
+    }
+
+    if (ok == 0) {
+        for (size_t i = 0; i < count; i++) secrets[i] = 0;
+    }
+    else {
+        // 2.  Montgomery 봰ڿ
+        DH_BATCH_JOB job;
+        mont_init(&job.mont, p);
+        job.bits = 0;
+        while (max_priv >> job.bits) job.bits++;
+        job.window = (job.bits <= 16) ? 2 : (job.bits <= 40) ? 3 : 4;
+        job.privs = local_privs;
+        job.pubs = remote_pubs;
+        job.secrets = secrets;
+        job.status = st;
+        if (count < PARALLEL_MIN_ITEMS) num_threads = 1;
+        parallel_for(count, num_threads, dh_batch_range, &job);
+    }
+
+    if (!status) delete[] st;
+    return ok;
 }
\ No newline at end of file
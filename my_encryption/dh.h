@@ -11,6 +11,14 @@ typedef struct {
     uint64 g; // Ԫ
 } DH_Context;
 
+// ԿЭ̵״̬ (浥νӿе printf )
+typedef enum {
+    DH_OK = 0,                 // ɹ
+    DH_ERR_PUBLIC_KEY = 1,     // ԷԿ [2, p-2]  ( 01p-1 СȺԪ)
+    DH_ERR_PRIVATE_KEY = 2,    // ˽ԿΪ 0
+    DH_ERR_PARAMS = 3          // Ч (p Ǵ 3 )
+} DH_STATUS;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -36,6 +44,18 @@ extern "C" {
      */
     uint64 dh_compute_shared_secret(const DH_Context* ctx, uint64 local_priv, uint64 remote_pub);
 
+    /**
+     * 3. 㹲 (Batch Shared Secrets)
+     * УйԿԹ Montgomery ġ4 ·Ĵģݼ㣬ϴʱָ̳߳
+     * @param local_privs / remote_pubs: count  (˽Կ, ԷԿ)
+     * @param secrets: ܣʧд 0
+     * @param status: ״̬ (Ϊ NULL)
+     * @param num_threads: ʹõ߳; <= 0 ʾʹȫ
+     * @return ɹ
+     */
+    size_t dh_compute_shared_secret_batch(const DH_Context* ctx, const uint64* local_privs, const uint64* remote_pubs,
+                                          uint64* secrets, DH_STATUS* status, size_t count, int num_threads);
+
 #ifdef __cplusplus
 }
 #endif
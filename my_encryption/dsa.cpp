@@ -23,7 +23,7 @@ bool dsa_generate_keys(uint64 p, uint64 q, uint64 g, uint64 x, DSA_PublicKey* pu
     priv->x = x;
 
     // 㹫Կ y = g^x mod p
-    uint64 y = power(g, x, p);
+    uint64 y = power_fixed_base(g, x, p);
 
     // 乫Կ
     pub->params = priv->params; // Ʋ
@@ -49,7 +49,7 @@ DSA_Signature dsa_sign(uint64 digest, uint64 k, const DSA_PrivateKey* priv) {
     }
 
     // 1.  r = (g^k mod p) mod q
-    uint64 gk = power(g, k, p);
+    uint64 gk = power_fixed_base(g, k, p); // g ̶
     sig.r = gk % q;
 
     if (sig.r == 0) {
@@ -83,6 +83,24 @@ DSA_Signature dsa_sign(uint64 digest, uint64 k, const DSA_PrivateKey* priv) {
     return sig;
 }
 
+// 2b. ʹԤԪǩ
+DSA_Signature dsa_sign_with_nonce(uint64 digest, const NONCE_TRIPLE* nonce, const DSA_PrivateKey* priv) {
+    DSA_Signature sig = { 0, 0 };
+    uint64 q = priv->params.q;
+    if (nonce->r == 0 || nonce->k_inv == 0) {
+        printf("Error: Invalid nonce triple.\n");
+        return sig;
+    }
+
+    sig.r = nonce->r;
+    uint64 sum = add_mod(digest % q, mul_mod(priv->x, sig.r, q), q);
+    sig.s = mul_mod(nonce->k_inv, sum, q);
+    if (sig.s == 0) {
+        printf("Error: s became 0. Need a new k.\n");
+    }
+    return sig;
+}
+
 // 3. DSA ǩ
 // w = s^(-1) mod q
 // u1 = (H(m) * w) mod q
@@ -112,19 +130,102 @@ bool dsa_verify(uint64 digest, DSA_Signature sig, const DSA_PublicKey* pub) {
     uint64 u2 = (sig.r * w) % q;
 
     // 5.  v = ((g^u1 * y^u2) mod p) mod q
-    // Ҫģݺһģ
-    uint64 term1 = power(g, u1, p); // g^u1 mod p
-    uint64 term2 = power(y, u2, p); // y^u2 mod p
-
-    // term1 * term2 mod p
-    // ͬΪ˷ֹ uint64 ˷ǰѾ֤ term1, term2 < p
-    //  p ӽ 2^32˻ܽӽ 2^64ֻҪ p < 2^32 (42)ǰȫġ
-    //  p  64 λҪ __int128 ģ˺
-    // ǵĽѧֱӳˡ
-    uint64 v_temp = (term1 * term2) % p;
+    // g Ĺ̶ѻʱg^u1 ֻˣʣ y^u2 һģݣ
+    // öͬʱģ (Shamir) ݹͬһƽ
+    uint64 v_temp;
+    const FIXED_BASE_TABLE* g_table = fixed_base_get(g, p);
+    if (g_table) {
+        v_temp = mul_mod(fixed_base_power(g_table, u1), power(y, u2, p), p);
+    }
+    else {
+        uint64 bases[2] = { g, y };
+        uint64 exps[2] = { u1, u2 };
+        v_temp = multi_power(bases, exps, 2, p);
+    }
 
     uint64 v = v_temp % q;
 
     // 6. ֤
     return (v == sig.r);
+}
+
+// 4. ǩ
+bool dsa_batch_init(DSA_BATCH_CTX* ctx, const DSA_PublicKey* pub) {
+    uint64 p = pub->params.p;
+    if (p < 2 || pub->params.q < 2 || pub->y == 0 || pub->y >= p) return false;
+    ctx->pub = *pub;
+    ctx->g_table = fixed_base_get(pub->params.g, p);
+    fixed_base_init(&ctx->y_table, pub->y, p);
+    return true;
+}
+
+typedef struct {
+    const DSA_BATCH_CTX* ctx;
+    const uint64* digests;
+    const DSA_Signature* sigs;
+    const uint64* w;                 // ǩ s^(-1) mod q0 ʾǩʽǷ
+    bool* ok;
+} DSA_VERIFY_JOB;
+
+static void dsa_verify_range(size_t begin, size_t end, void* arg) {
+    const DSA_VERIFY_JOB* job = (const DSA_VERIFY_JOB*)arg;
+    const DSA_BATCH_CTX* ctx = job->ctx;
+    uint64 p = ctx->pub.params.p;
+    uint64 q = ctx->pub.params.q;
+
+    for (size_t i = begin; i < end; i++) {
+        uint64 w = job->w[i];
+        if (w == 0) { job->ok[i] = false; continue; }
+
+        uint64 u1 = mul_mod(job->digests[i] % q, w, q);
+        uint64 u2 = mul_mod(job->sigs[i].r, w, q);
+        uint64 gu1 = ctx->g_table ? fixed_base_power(ctx->g_table, u1) : power(ctx->pub.params.g, u1, p);
+        uint64 yu2 = fixed_base_power(&ctx->y_table, u2);
+        job->ok[i] = (mul_mod(gu1, yu2, p) % q == job->sigs[i].r);
+    }
+}
+
+size_t dsa_verify_batch(const DSA_BATCH_CTX* ctx, const uint64* digests, const DSA_Signature* sigs,
+                        bool* results, size_t count, int num_threads) {
+    if (count == 0) return 0;
+    uint64 q = ctx->pub.params.q;
+
+    bool* ok = results ? results : new bool[count];
+    uint64* w = new uint64[count];
+
+    // Montgomery : prefix[i] = s_0 * ... * s_iֻܳ˻һ棬ٴӺǰÿ s_i^(-1)
+    // ʽǷǩ 1 ˻Ϊ 0
+    uint64 acc = 1 % q;
+    for (size_t i = 0; i < count; i++) {
+        bool valid = sigs[i].r > 0 && sigs[i].r < q && sigs[i].s > 0 && sigs[i].s < q;
+        w[i] = acc; // ݴ s_0 * ... * s_(i-1)
+        if (valid) acc = mul_mod(acc, sigs[i].s, q);
+    }
+    uint64 inv = mod_inverse(acc, q);
+    for (size_t i = count; i-- > 0;) {
+        bool valid = sigs[i].r > 0 && sigs[i].r < q && sigs[i].s > 0 && sigs[i].s < q;
+        if (!valid || inv == 0) {
+            // inv == 0 ˵ q ˻
+            w[i] = valid ? mod_inverse(sigs[i].s, q) : 0;
+            continue;
+        }
+        uint64 prefix = w[i];
+        w[i] = mul_mod(inv, prefix, q);        // s_i^(-1) = (s_0..s_i)^(-1) * (s_0..s_(i-1))
+        inv = mul_mod(inv, sigs[i].s, q);      // ȥ s_iõ (s_0..s_(i-1))^(-1)
+    }
+
+    DSA_VERIFY_JOB job;
+    job.ctx = ctx;
+    job.digests = digests;
+    job.sigs = sigs;
+    job.w = w;
+    job.ok = ok;
+    if (count < PARALLEL_MIN_ITEMS) num_threads = 1;
+    parallel_for(count, num_threads, dsa_verify_range, &job);
+
+    size_t valid = 0;
+    for (size_t i = 0; i < count; i++) valid += ok[i] ? 1 : 0;
+    delete[] w;
+    if (!results) delete[] ok;
+    return valid;
 }
\ No newline at end of file
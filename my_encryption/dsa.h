@@ -29,6 +29,14 @@ typedef struct {
     uint64 s;
 } DSA_Signature;
 
+// ǩ: ͬһԿǩʱ y Ĺ̶ɵ÷в湫Կ
+// g ıȡȫֻ (Ԫʹ)y ıֻڸģռȫֻ
+typedef struct {
+    DSA_PublicKey pub;
+    const FIXED_BASE_TABLE* g_table; // ȫֻʱΪ NULL˻ power
+    FIXED_BASE_TABLE y_table;        // y Ĺ̶ (Լ 240 ģ)
+} DSA_BATCH_CTX;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -53,6 +61,13 @@ extern "C" {
      */
     DSA_Signature dsa_sign(uint64 digest, uint64 k, const DSA_PrivateKey* priv);
 
+    /**
+     * DSA ǩ (ʹԤԪ)
+     * r  k^(-1) ãֻʣ s = k^(-1) * (H(m) + x*r) mod q ģ
+     * @param nonce:  nonce_pool_pop ȡԪ飬ÿֻʹһ
+     */
+    DSA_Signature dsa_sign_with_nonce(uint64 digest, const NONCE_TRIPLE* nonce, const DSA_PrivateKey* priv);
+
     // --- 3. ǩ ---
     /**
      * DSA ǩ
@@ -63,6 +78,25 @@ extern "C" {
      */
     bool dsa_verify(uint64 digest, DSA_Signature sig, const DSA_PublicKey* pub);
 
+    // --- 4. ǩ ---
+    /**
+     * ʼǩ: ȡ g ĻΪ y ֮ͬһԿÿǩٽ
+     * @return: pq < 2  y  [1, p) ʱ false
+     */
+    bool dsa_batch_init(DSA_BATCH_CTX* ctx, const DSA_PublicKey* pub);
+
+    /**
+     * ͬһԿǩ
+     *  s^(-1) mod q  Montgomery 漼ɺϲΪһ mod_inverse
+     * g^u1 * y^u2 еŹ̶Ҫƽָ̳߳
+     * @param ctx:  dsa_batch_init ʼ
+     * @param results: ÿǩ֤ (Ϊ NULL)
+     * @param num_threads: ʹõ߳; <= 0 ʾʹȫ
+     * @return: ֤ͨǩ
+     */
+    size_t dsa_verify_batch(const DSA_BATCH_CTX* ctx, const uint64* digests, const DSA_Signature* sigs,
+                            bool* results, size_t count, int num_threads);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,9 @@
 #include "ecc.h"
 #include <stdio.h>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
 
 // : ȽǷ
 static bool points_equal(ECC_Point P, ECC_Point Q) {
@@ -8,6 +12,9 @@ static bool points_equal(ECC_Point P, ECC_Point Q) {
     return (P.x == Q.x) && (P.y == Q.y);
 }
 
+// ģ p : ȱȽټp ӽ 2^64 ʱҲ (ģ utils  add_mod)
+static inline uint64 fe_sub(uint64 a, uint64 b, uint64 p) { return (a >= b) ? a - b : a + (p - b); }
+
 // 1. Ƿ
 // y^2 = x^3 + ax + b (mod p)
 bool ecc_is_on_curve(ECC_Point P, ECC_Curve curve) {
@@ -18,8 +25,8 @@ bool ecc_is_on_curve(ECC_Point P, ECC_Curve curve) {
 
     // RHS = x^3 + ax + b
     uint64 rhs = power(P.x, 3, curve.p);
-    uint64 ax = (curve.a * P.x) % curve.p;
-    rhs = (rhs + ax + curve.b) % curve.p;
+    uint64 ax = mul_mod(curve.a % curve.p, P.x, curve.p);
+    rhs = add_mod(add_mod(rhs, ax, curve.p), curve.b % curve.p, curve.p);
 
     return lhs == rhs;
 }
@@ -36,35 +43,31 @@ ECC_Point ecc_point_add(ECC_Point P, ECC_Point Q, ECC_Curve curve) {
     // 2: P  Q x ͬ
     if (P.x == Q.x) {
         // P = -Q (ֱ)Զ
-        // жϷ: y1 = -y2 mod p => (y1 + y2) % p == 0
-        if ((P.y + Q.y) % curve.p == 0) {
+        // жϷ: y1 = -y2 mod p => (y1 + y2) mod p == 0
+        if (add_mod(P.y, Q.y, curve.p) == 0) {
             R.is_infinity = true;
             return R;
         }
         // P = Q (ͬһ)ִе㱶
         if (P.y == Q.y) {
             // б lambda = (3x^2 + a) * (2y)^(-1) mod p
-            uint64 num = (3 * power(P.x, 2, curve.p) + curve.a) % curve.p;
-            uint64 den = (2 * P.y) % curve.p;
+            uint64 num = add_mod(mul_mod(3, mul_mod(P.x, P.x, curve.p), curve.p), curve.a % curve.p, curve.p);
+            uint64 den = mul_mod(2, P.y, curve.p);
             uint64 den_inv = mod_inverse(den, curve.p);
 
             if (den_inv == 0) { // ֱ
                 R.is_infinity = true; return R;
             }
 
-            uint64 lambda = (num * den_inv) % curve.p;
+            uint64 lambda = mul_mod(num, den_inv, curve.p);
 
-            // rx = lambda^2 - 2x
-            // rx = (lambda^2 - 2x) mod p
-            // : (A - B) mod p -> (A + p - (B%p)) % p
-            uint64 l2 = power(lambda, 2, curve.p);
-            uint64 two_x = (2 * P.x) % curve.p;
-            R.x = (l2 >= two_x) ? (l2 - two_x) : (l2 + curve.p - two_x);
+            // rx = (lambda^2 - 2x) mod pӼ add_mod / fe_subp > 2^63 ʱҲ
+            uint64 l2 = mul_mod(lambda, lambda, curve.p);
+            R.x = fe_sub(l2, add_mod(P.x, P.x, curve.p), curve.p);
 
             // ry = lambda(x - rx) - y
-            uint64 x_diff = (P.x >= R.x) ? (P.x - R.x) : (P.x + curve.p - R.x);
-            uint64 term = (lambda * x_diff) % curve.p;
-            R.y = (term >= P.y) ? (term - P.y) : (term + curve.p - P.y);
+            uint64 term = mul_mod(lambda, fe_sub(P.x, R.x, curve.p), curve.p);
+            R.y = fe_sub(term, P.y, curve.p);
 
             return R;
         }
@@ -72,45 +75,726 @@ ECC_Point ecc_point_add(ECC_Point P, ECC_Point Q, ECC_Curve curve) {
 
     // 3: P != Q (ͨӷ)
     // б lambda = (y2 - y1) * (x2 - x1)^(-1) mod p
-    uint64 num, den;
-    if (Q.y >= P.y) num = Q.y - P.y;
-    else num = Q.y + curve.p - P.y;
-
-    if (Q.x >= P.x) den = Q.x - P.x;
-    else den = Q.x + curve.p - P.x;
-
+    uint64 num = fe_sub(Q.y, P.y, curve.p);
+    uint64 den = fe_sub(Q.x, P.x, curve.p);
     uint64 den_inv = mod_inverse(den, curve.p);
-    uint64 lambda = (num * den_inv) % curve.p;
+    uint64 lambda = mul_mod(num, den_inv, curve.p);
 
     // rx = lambda^2 - x1 - x2
-    uint64 l2 = power(lambda, 2, curve.p);
-    uint64 x_sum = (P.x + Q.x) % curve.p;
-    R.x = (l2 >= x_sum) ? (l2 - x_sum) : (l2 + curve.p - x_sum);
+    uint64 l2 = mul_mod(lambda, lambda, curve.p);
+    R.x = fe_sub(l2, add_mod(P.x, Q.x, curve.p), curve.p);
 
     // ry = lambda(x1 - rx) - y1
-    uint64 x_diff = (P.x >= R.x) ? (P.x - R.x) : (P.x + curve.p - R.x);
-    uint64 term = (lambda * x_diff) % curve.p;
-    R.y = (term >= P.y) ? (term - P.y) : (term + curve.p - P.y);
+    uint64 term = mul_mod(lambda, fe_sub(P.x, R.x, curve.p), curve.p);
+    R.y = fe_sub(term, P.y, curve.p);
 
     return R;
 }
 
-// 3. ˷ R = k * P (Double-and-Add 㷨)
-ECC_Point ecc_scalar_mult(uint64 k, ECC_Point P, ECC_Curve curve) {
+// --- ſɱ ---
+
+ECC_JacobianPoint ecc_to_jacobian(ECC_Point P) {
+    ECC_JacobianPoint J;
+    if (P.is_infinity) { J.X = 1; J.Y = 1; J.Z = 0; }
+    else { J.X = P.x; J.Y = P.y; J.Z = 1; }
+    return J;
+}
+
+// x = X / Z^2, y = Y / Z^3
+ECC_Point ecc_from_jacobian(ECC_JacobianPoint P, ECC_Curve curve) {
     ECC_Point R;
-    R.is_infinity = true; // R = 0 (Infinity)
-    ECC_Point Temp = P;
+    if (P.Z == 0) {
+        R.x = 0; R.y = 0; R.is_infinity = true;
+        return R;
+    }
+    uint64 p = curve.p;
+    uint64 z_inv = mod_inverse(P.Z, p);
+    uint64 z_inv2 = mul_mod(z_inv, z_inv, p);
+    R.x = mul_mod(P.X, z_inv2, p);
+    R.y = mul_mod(P.Y, mul_mod(z_inv2, z_inv, p), p);
+    R.is_infinity = false;
+    return R;
+}
+
+// Montgomery : ǰ׺ Z_0 * ... * Z_(i-1) ݴ out[i].x У
+// һӺǰΰÿ Z^(-1)Ҫ⻺
+void ecc_batch_normalize(const ECC_JacobianPoint* in, ECC_Point* out, size_t count, ECC_Curve curve) {
+    uint64 p = curve.p;
+    uint64 acc = 1 % p;
+    for (size_t i = 0; i < count; i++) {
+        out[i].x = acc;
+        if (in[i].Z != 0) acc = mul_mod(acc, in[i].Z, p);
+    }
+    uint64 inv = mod_inverse(acc, p);
+    for (size_t i = count; i-- > 0;) {
+        if (in[i].Z == 0) {
+            out[i].x = 0; out[i].y = 0; out[i].is_infinity = true;
+            continue;
+        }
+        uint64 z_inv = mul_mod(inv, out[i].x, p);
+        inv = mul_mod(inv, in[i].Z, p);
+        uint64 z_inv2 = mul_mod(z_inv, z_inv, p);
+        out[i].x = mul_mod(in[i].X, z_inv2, p);
+        out[i].y = mul_mod(in[i].Y, mul_mod(z_inv2, z_inv, p), p);
+        out[i].is_infinity = false;
+    }
+}
+
+//  (һ a):
+// S = 4*X*Y^2, M = 3*X^2 + a*Z^4
+// X3 = M^2 - 2S, Y3 = M*(S - X3) - 8*Y^4, Z3 = 2*Y*Z
+ECC_JacobianPoint ecc_jacobian_double(ECC_JacobianPoint P, ECC_Curve curve) {
+    uint64 p = curve.p;
+    if (P.Z == 0 || P.Y == 0) {
+        ECC_JacobianPoint inf = { 1, 1, 0 };
+        return inf;
+    }
+
+    uint64 XX = mul_mod(P.X, P.X, p);
+    uint64 YY = mul_mod(P.Y, P.Y, p);
+    uint64 YYYY = mul_mod(YY, YY, p);
+    uint64 ZZ = mul_mod(P.Z, P.Z, p);
+
+    // СӴģ
+    uint64 S = mul_mod(P.X, YY, p);
+    S = add_mod(S, S, p);
+    S = add_mod(S, S, p);
+    uint64 M = add_mod(add_mod(XX, XX, p), XX, p);
+    uint64 a = curve.a % p;
+    if (a != 0) M = add_mod(M, mul_mod(a, mul_mod(ZZ, ZZ, p), p), p);
+    uint64 Y8 = add_mod(YYYY, YYYY, p);
+    Y8 = add_mod(Y8, Y8, p);
+    Y8 = add_mod(Y8, Y8, p);
+
+    ECC_JacobianPoint R;
+    R.X = fe_sub(mul_mod(M, M, p), add_mod(S, S, p), p);
+    R.Y = fe_sub(mul_mod(M, fe_sub(S, R.X, p), p), Y8, p);
+    R.Z = mul_mod(add_mod(P.Y, P.Y, p), P.Z, p);
+    return R;
+}
+
+// :
+// U1 = X1*Z2^2, U2 = X2*Z1^2, S1 = Y1*Z2^3, S2 = Y2*Z1^3, H = U2 - U1, r = S2 - S1
+// X3 = r^2 - H^3 - 2*U1*H^2, Y3 = r*(U1*H^2 - X3) - S1*H^3, Z3 = Z1*Z2*H
+ECC_JacobianPoint ecc_jacobian_add(ECC_JacobianPoint P, ECC_JacobianPoint Q, ECC_Curve curve) {
+    if (P.Z == 0) return Q;
+    if (Q.Z == 0) return P;
+    uint64 p = curve.p;
+
+    uint64 Z1Z1 = mul_mod(P.Z, P.Z, p);
+    uint64 Z2Z2 = mul_mod(Q.Z, Q.Z, p);
+    uint64 U1 = mul_mod(P.X, Z2Z2, p);
+    uint64 U2 = mul_mod(Q.X, Z1Z1, p);
+    uint64 S1 = mul_mod(P.Y, mul_mod(Q.Z, Z2Z2, p), p);
+    uint64 S2 = mul_mod(Q.Y, mul_mod(P.Z, Z1Z1, p), p);
+    uint64 H = fe_sub(U2, U1, p);
+    uint64 r = fe_sub(S2, S1, p);
+
+    if (H == 0) {
+        if (r == 0) return ecc_jacobian_double(P, curve); // P == Q
+        ECC_JacobianPoint inf = { 1, 1, 0 };               // P == -Q
+        return inf;
+    }
+
+    uint64 HH = mul_mod(H, H, p);
+    uint64 HHH = mul_mod(H, HH, p);
+    uint64 V = mul_mod(U1, HH, p);
+
+    ECC_JacobianPoint R;
+    R.X = fe_sub(fe_sub(mul_mod(r, r, p), HHH, p), add_mod(V, V, p), p);
+    R.Y = fe_sub(mul_mod(r, fe_sub(V, R.X, p), p), mul_mod(S1, HHH, p), p);
+    R.Z = mul_mod(mul_mod(P.Z, Q.Z, p), H, p);
+    return R;
+}
+
+// ϵ: Q  Z = 1 U1 = X1, S1 = Y1ʡ Z2 йصĳ˷
+ECC_JacobianPoint ecc_jacobian_add_affine(ECC_JacobianPoint P, ECC_Point Q, ECC_Curve curve) {
+    if (Q.is_infinity) return P;
+    if (P.Z == 0) return ecc_to_jacobian(Q);
+    uint64 p = curve.p;
+
+    uint64 Z1Z1 = mul_mod(P.Z, P.Z, p);
+    uint64 U2 = mul_mod(Q.x, Z1Z1, p);
+    uint64 S2 = mul_mod(Q.y, mul_mod(P.Z, Z1Z1, p), p);
+    uint64 H = fe_sub(U2, P.X, p);
+    uint64 r = fe_sub(S2, P.Y, p);
+
+    if (H == 0) {
+        if (r == 0) return ecc_jacobian_double(P, curve);
+        ECC_JacobianPoint inf = { 1, 1, 0 };
+        return inf;
+    }
+
+    uint64 HH = mul_mod(H, H, p);
+    uint64 HHH = mul_mod(H, HH, p);
+    uint64 V = mul_mod(P.X, HH, p);
+
+    ECC_JacobianPoint R;
+    R.X = fe_sub(fe_sub(mul_mod(r, r, p), HHH, p), add_mod(V, V, p), p);
+    R.Y = fe_sub(mul_mod(r, fe_sub(V, R.X, p), p), mul_mod(P.Y, HHH, p), p);
+    R.Z = mul_mod(P.Z, H, p);
+    return R;
+}
+
+// --- wNAF ˷ ---
+int ecc_wnaf_recode(uint64 k, int w, int* digits) {
+    int len = 0;
+    uint64 carry = 0; // k  |d| ܳ 2^64λ
+    uint64 mask = (1ULL << w) - 1;
+    int64 half = 1LL << (w - 1);
 
-    while (k > 0) {
+    while (k != 0 || carry != 0) {
+        int d = 0;
         if (k & 1) {
-            R = ecc_point_add(R, Temp, curve);
+            int64 v = (int64)(k & mask);
+            if (v >= half) v -= (int64)(mask + 1);
+            d = (int)v;
+            if (v > 0) {
+                k -= (uint64)v;
+            }
+            else {
+                uint64 old = k;
+                k += (uint64)(-v);
+                if (k < old) carry = 1;
+            }
+        }
+        digits[len++] = d;
+        k = (k >> 1) | (carry << 63);
+        carry = 0;
+    }
+    return len;
+}
+
+int ecc_wnaf_window(uint64 k) {
+    int bits = 0;
+    while (bits < 64 && (k >> bits)) bits++;
+    // Ԥ 2^(w-2) ĿҪѭĵ̯
+    if (bits < 12) return 2;
+    if (bits < 40) return 3;
+    return 4;
+}
+
+// : table[i] = (2i+1) * Pi < 2^(w-2)һתΪ
+static void build_odd_table(ECC_Point P, int w, ECC_Curve curve, ECC_Point* table) {
+    int table_size = 1 << (w - 2);
+    ECC_JacobianPoint jt[1 << (ECC_WNAF_MAX_WINDOW - 2)];
+    jt[0] = ecc_to_jacobian(P);
+    if (table_size > 1) {
+        ECC_JacobianPoint P2 = ecc_jacobian_double(jt[0], curve);
+        for (int i = 1; i < table_size; i++) jt[i] = ecc_jacobian_add(jt[i - 1], P2, curve);
+    }
+    ecc_batch_normalize(jt, table, table_size, curve);
+}
+
+// R += d * Podd[j * stride] = (2j+1) * Pֱȡ (x, -y)
+static inline ECC_JacobianPoint add_wnaf_digit(ECC_JacobianPoint R, int d, const ECC_Point* odd, int stride, ECC_Curve curve) {
+    if (d > 0) return ecc_jacobian_add_affine(R, odd[(d >> 1) * stride], curve);
+    ECC_Point neg = odd[((-d) >> 1) * stride];
+    if (!neg.is_infinity && neg.y != 0) neg.y = curve.p - neg.y;
+    return ecc_jacobian_add_affine(R, neg, curve);
+}
+
+ECC_JacobianPoint ecc_jacobian_scalar_mult_wnaf(uint64 k, ECC_Point P, int w, ECC_Curve curve) {
+    ECC_JacobianPoint R = { 1, 1, 0 };
+    if (P.is_infinity || k == 0) return R;
+    if (w < 2) w = 2;
+    if (w > ECC_WNAF_MAX_WINDOW) w = ECC_WNAF_MAX_WINDOW;
+
+    ECC_Point table[1 << (ECC_WNAF_MAX_WINDOW - 2)];
+    build_odd_table(P, w, curve, table);
+
+    int digits[ECC_WNAF_MAX_DIGITS];
+    int len = ecc_wnaf_recode(k, w, digits);
+    for (int i = len - 1; i >= 0; i--) {
+        R = ecc_jacobian_double(R, curve);
+        if (digits[i]) R = add_wnaf_digit(R, digits[i], table, 1, curve);
+    }
+    return R;
+}
+
+ECC_JacobianPoint ecc_jacobian_scalar_mult(uint64 k, ECC_Point P, ECC_Curve curve) {
+    return ecc_jacobian_scalar_mult_wnaf(k, P, ecc_wnaf_window(k), curve);
+}
+
+// --- ̶ ---
+bool ecc_fixed_base_init(ECC_FIXED_BASE_TABLE* table, ECC_Point G, ECC_Curve curve, int w) {
+    table->table = nullptr;
+    if (G.is_infinity || w < ECC_FIXED_BASE_MIN_WINDOW || w > ECC_FIXED_BASE_MAX_WINDOW) return false;
+
+    int cols = (1 << w) - 1;
+    int rows = (64 + w - 1) / w;
+    int count = rows * cols;
+    ECC_Point* points = new (std::nothrow) ECC_Point[count];
+    if (points == nullptr) return false;
+
+    // ſɱۼ: row[d - 1] = d * BB = 2^(w*i) * Gһе B = 2^w * B
+    std::vector<ECC_JacobianPoint> jt(count);
+    ECC_JacobianPoint base = ecc_to_jacobian(G);
+    for (int i = 0; i < rows; i++) {
+        ECC_JacobianPoint* row = &jt[(size_t)i * cols];
+        row[0] = base;
+        for (int d = 1; d < cols; d++) row[d] = ecc_jacobian_add(row[d - 1], base, curve);
+        base = ecc_jacobian_add(row[cols - 1], base, curve);
+    }
+    ecc_batch_normalize(jt.data(), points, count, curve);
+
+    table->curve = curve;
+    table->G = G;
+    table->w = w;
+    table->rows = rows;
+    table->table = points;
+    return true;
+}
+
+void ecc_fixed_base_free(ECC_FIXED_BASE_TABLE* table) {
+    delete[] table->table;
+    table->table = nullptr;
+}
+
+ECC_JacobianPoint ecc_fixed_base_mult(const ECC_FIXED_BASE_TABLE* table, uint64 k) {
+    ECC_JacobianPoint R = { 1, 1, 0 };
+    int w = table->w;
+    int cols = (1 << w) - 1;
+    uint64 mask = (uint64)cols;
+    for (int i = 0; k != 0; i++, k >>= w) {
+        uint64 d = k & mask;
+        if (d) R = ecc_jacobian_add_affine(R, table->table[(size_t)i * cols + d - 1], table->curve);
+    }
+    return R;
+}
+
+// λֻ: ɨѷĲλдڻڽٷ
+static std::atomic<ECC_FIXED_BASE_TABLE*> ecc_fixed_base_cache[ECC_FIXED_BASE_CACHE_SIZE];
+static std::mutex ecc_fixed_base_cache_lock;
+static std::atomic<int> ecc_fixed_base_window(ECC_FIXED_BASE_DEFAULT_WINDOW);
+
+static bool same_curve(ECC_Curve c1, ECC_Point G1, ECC_Curve c2, ECC_Point G2) {
+    return G1.x == G2.x && G1.y == G2.y && G1.is_infinity == G2.is_infinity &&
+           c1.p == c2.p && c1.a == c2.a && c1.b == c2.b && c1.n == c2.n;
+}
+
+static bool same_curve_point(const ECC_FIXED_BASE_TABLE* t, ECC_Point G, ECC_Curve curve, int w) {
+    return t->w == w && same_curve(t->curve, t->G, curve, G);
+}
+
+static const ECC_FIXED_BASE_TABLE* ecc_fixed_base_find(ECC_Point G, ECC_Curve curve, int w) {
+    for (int i = 0; i < ECC_FIXED_BASE_CACHE_SIZE; i++) {
+        const ECC_FIXED_BASE_TABLE* t = ecc_fixed_base_cache[i].load(std::memory_order_acquire);
+        if (t == nullptr) break;
+        if (same_curve_point(t, G, curve, w)) return t;
+    }
+    return nullptr;
+}
+
+bool ecc_fixed_base_set_window(int w) {
+    if (w < ECC_FIXED_BASE_MIN_WINDOW || w > ECC_FIXED_BASE_MAX_WINDOW) return false;
+    ecc_fixed_base_window.store(w, std::memory_order_relaxed);
+    return true;
+}
+
+const ECC_FIXED_BASE_TABLE* ecc_fixed_base_get(ECC_Point G, ECC_Curve curve) {
+    if (G.is_infinity) return nullptr;
+    int w = ecc_fixed_base_window.load(std::memory_order_relaxed);
+    const ECC_FIXED_BASE_TABLE* t = ecc_fixed_base_find(G, curve, w);
+    if (t) return t;
+
+    std::lock_guard<std::mutex> lk(ecc_fixed_base_cache_lock);
+    t = ecc_fixed_base_find(G, curve, w); // ܸ߳̿ոս
+    if (t) return t;
+    for (int i = 0; i < ECC_FIXED_BASE_CACHE_SIZE; i++) {
+        if (ecc_fixed_base_cache[i].load(std::memory_order_relaxed) == nullptr) {
+            ECC_FIXED_BASE_TABLE* table = new ECC_FIXED_BASE_TABLE;
+            if (!ecc_fixed_base_init(table, G, curve, w)) {
+                delete table;
+                return nullptr;
+            }
+            ecc_fixed_base_cache[i].store(table, std::memory_order_release);
+            return table;
+        }
+    }
+    return nullptr;
+}
+
+ECC_Point ecc_scalar_mult_base(uint64 k, ECC_Point G, ECC_Curve curve) {
+    const ECC_FIXED_BASE_TABLE* t = ecc_fixed_base_get(G, curve);
+    if (t == nullptr) return ecc_scalar_mult(k, G, curve);
+    return ecc_from_jacobian(ecc_fixed_base_mult(t, k), curve);
+}
+
+// --- ˫˷ (Shamir / Straus) ---
+//  wNAF رһ: ȡϳߣӴΪ֮
+static ECC_JacobianPoint straus_wnaf(uint64 u1, int w1, const ECC_Point* odd1, int stride1,
+                                     uint64 u2, int w2, const ECC_Point* odd2, int stride2, ECC_Curve curve) {
+    int d1[ECC_WNAF_MAX_DIGITS], d2[ECC_WNAF_MAX_DIGITS];
+    int len1 = ecc_wnaf_recode(u1, w1, d1);
+    int len2 = ecc_wnaf_recode(u2, w2, d2);
+    int len = len1 > len2 ? len1 : len2;
+
+    ECC_JacobianPoint R = { 1, 1, 0 };
+    for (int i = len - 1; i >= 0; i--) {
+        R = ecc_jacobian_double(R, curve);
+        if (i < len1 && d1[i]) R = add_wnaf_digit(R, d1[i], odd1, stride1, curve);
+        if (i < len2 && d2[i]) R = add_wnaf_digit(R, d2[i], odd2, stride2, curve);
+    }
+    return R;
+}
+
+ECC_JacobianPoint ecc_jacobian_double_mult(uint64 u1, ECC_Point P1, uint64 u2, ECC_Point P2, ECC_Curve curve) {
+    if (P1.is_infinity || u1 == 0) return ecc_jacobian_scalar_mult(u2, P2, curve);
+    if (P2.is_infinity || u2 == 0) return ecc_jacobian_scalar_mult(u1, P1, curve);
+
+    int w1 = ecc_wnaf_window(u1), w2 = ecc_wnaf_window(u2);
+    ECC_Point odd1[1 << (ECC_WNAF_MAX_WINDOW - 2)], odd2[1 << (ECC_WNAF_MAX_WINDOW - 2)];
+    build_odd_table(P1, w1, curve, odd1);
+    build_odd_table(P2, w2, curve, odd2);
+    return straus_wnaf(u1, w1, odd1, 1, u2, w2, odd2, 1, curve);
+}
+
+ECC_JacobianPoint ecc_jacobian_double_mult_base(uint64 u1, ECC_Point G, uint64 u2, ECC_Point Q, ECC_Curve curve) {
+    const ECC_FIXED_BASE_TABLE* t = ecc_fixed_base_get(G, curve);
+    if (t == nullptr) return ecc_jacobian_double_mult(u1, G, u2, Q, curve);
+    if (u2 == 0 || Q.is_infinity) return ecc_fixed_base_mult(t, u1);
+
+    // ̶ 0 о G, 2G, ..., (2^w - 1)Gе ( 2) ǿ w+1  wNAF 
+    // G һ˲ýҴڱ Q һӸ
+    int w2 = ecc_wnaf_window(u2);
+    ECC_Point odd2[1 << (ECC_WNAF_MAX_WINDOW - 2)];
+    build_odd_table(Q, w2, curve, odd2);
+    return straus_wnaf(u1, t->w + 1, t->table, 2, u2, w2, odd2, 1, curve);
+}
+
+// --- ˷ (Pippenger) ---
+#define ECC_MSM_PARALLEL_MIN 64
+
+// 㿪 (ģ˼): ÿ count ӷ (Լ 6 ) + ǰ׺ 2^c ſɱȼӷ (Լ 27 )
+// Ӻϲʱ bits α (Լ 10 )
+static int msm_window(size_t count, int bits) {
+    int best_c = 1;
+    double best = 0;
+    for (int c = 1; c <= ECC_MSM_MAX_WINDOW; c++) {
+        int windows = (bits + c - 1) / c;
+        double cost = windows * ((double)count * 6 + (double)(1 << c) * 27) + (double)bits * 10;
+        if (c == 1 || cost < best) { best = cost; best_c = c; }
+    }
+    return best_c;
+}
+
+// ӷ: buckets[idx[j]] += pts[j]ͬһÿͰһ
+// бʵķĸ (x2 - x1  2y)  Montgomery ɹһ
+static void bucket_add_batch(ECC_Point* buckets, const uint32* idx, const ECC_Point* pts, size_t n,
+                             ECC_Curve curve, uint64* den, uint64* prefix) {
+    uint64 p = curve.p;
+    uint64 acc = 1;
+    for (size_t j = 0; j < n; j++) {
+        ECC_Point* B = &buckets[idx[j]];
+        const ECC_Point* P = &pts[j];
+        den[j] = 0;
+        if (B->is_infinity) {
+            *B = *P;
+        }
+        else if (B->x != P->x) {
+            den[j] = fe_sub(P->x, B->x, p);
+        }
+        else if (B->y == P->y && B->y != 0) {
+            den[j] = add_mod(B->y, B->y, p);
+        }
+        else {
+            B->x = 0; B->y = 0; B->is_infinity = true; // B = -P
+        }
+        prefix[j] = acc;
+        if (den[j]) acc = mul_mod(acc, den[j], p);
+    }
+
+    uint64 inv = mod_inverse(acc, p);
+    for (size_t j = n; j-- > 0;) {
+        if (den[j] == 0) continue;
+        uint64 d_inv = mul_mod(inv, prefix[j], p);
+        inv = mul_mod(inv, den[j], p);
+
+        ECC_Point* B = &buckets[idx[j]];
+        const ECC_Point* P = &pts[j];
+        uint64 num;
+        if (B->x != P->x) {
+            num = fe_sub(P->y, B->y, p);
+        }
+        else {
+            uint64 xx = mul_mod(B->x, B->x, p);
+            num = add_mod(add_mod(add_mod(xx, xx, p), xx, p), curve.a % p, p);
+        }
+        uint64 lambda = mul_mod(num, d_inv, p);
+        uint64 x3 = fe_sub(fe_sub(mul_mod(lambda, lambda, p), B->x, p), P->x, p);
+        B->y = fe_sub(mul_mod(lambda, fe_sub(B->x, x3, p), p), B->y, p);
+        B->x = x3;
+    }
+}
+
+typedef struct {
+    const uint64* scalars;
+    const ECC_Point* points;
+    size_t count;
+    ECC_Curve curve;
+    int c;                       // ڿ
+    ECC_JacobianPoint* sums;     // ڵ sum(d * B_d)
+} ECC_MSM_JOB;
+
+static void msm_window_range(size_t begin, size_t end, void* arg) {
+    const ECC_MSM_JOB* job = (const ECC_MSM_JOB*)arg;
+    ECC_Curve curve = job->curve;
+    int c = job->c;
+    uint32 mask = (uint32)((1u << c) - 1);
+    size_t nb = mask;
+    ECC_Point inf = { 0, 0, true };
+
+    std::vector<ECC_Point> buckets(nb);
+    std::vector<uint32> stamp(nb);
+    std::vector<size_t> pending, next;
+    uint32 idx[ECC_MSM_BATCH];
+    ECC_Point pts[ECC_MSM_BATCH];
+    uint64 den[ECC_MSM_BATCH], prefix[ECC_MSM_BATCH];
+
+    for (size_t win = begin; win < end; win++) {
+        int shift = (int)win * c;
+        for (size_t b = 0; b < nb; b++) { buckets[b] = inf; stamp[b] = 0; }
+        uint32 round = 0;
+
+        pending.clear();
+        for (size_t i = 0; i < job->count; i++) {
+            if (!job->points[i].is_infinity && ((job->scalars[i] >> shift) & mask) != 0) pending.push_back(i);
+        }
+
+        // ˳: ͰڱѳֵĵƳٵһ
+        while (!pending.empty()) {
+            next.clear();
+            size_t n = 0;
+            round++;
+            for (size_t t = 0; t < pending.size(); t++) {
+                size_t i = pending[t];
+                uint32 b = (uint32)((job->scalars[i] >> shift) & mask) - 1;
+                if (stamp[b] == round) { next.push_back(i); continue; }
+                stamp[b] = round;
+                idx[n] = b;
+                pts[n] = job->points[i];
+                if (++n == ECC_MSM_BATCH) {
+                    bucket_add_batch(buckets.data(), idx, pts, n, curve, den, prefix);
+                    n = 0;
+                    round++;
+                }
+            }
+            if (n) bucket_add_batch(buckets.data(), idx, pts, n, curve, den, prefix);
+            pending.swap(next);
+        }
+
+        // sum(d * B_d) = sum_k (B_k + B_(k+1) + ... + B_max)
+        ECC_JacobianPoint running = { 1, 1, 0 }, total = { 1, 1, 0 };
+        for (size_t b = nb; b-- > 0;) {
+            running = ecc_jacobian_add_affine(running, buckets[b], curve);
+            total = ecc_jacobian_add(total, running, curve);
         }
-        Temp = ecc_point_add(Temp, Temp, curve); // Double
-        k >>= 1;
+        job->sums[win] = total;
+    }
+}
+
+ECC_JacobianPoint ecc_jacobian_multi_scalar_mult(const uint64* scalars, const ECC_Point* points, size_t count,
+                                                 ECC_Curve curve, int num_threads) {
+    ECC_JacobianPoint R = { 1, 1, 0 };
+    int bits = 0;
+    for (size_t i = 0; i < count; i++) {
+        while (bits < 64 && (scalars[i] >> bits)) bits++;
+    }
+    if (bits == 0) return R;
+    if (count == 1) return ecc_jacobian_scalar_mult(scalars[0], points[0], curve);
+
+    ECC_MSM_JOB job;
+    job.scalars = scalars;
+    job.points = points;
+    job.count = count;
+    job.curve = curve;
+    job.c = msm_window(count, bits);
+    int windows = (bits + job.c - 1) / job.c;
+    std::vector<ECC_JacobianPoint> sums(windows);
+    job.sums = sums.data();
+    if (count < ECC_MSM_PARALLEL_MIN) num_threads = 1;
+    parallel_for((size_t)windows, num_threads, msm_window_range, &job);
+
+    // ߴڿʼ: R = 2^c * R + S_j
+    for (int j = windows - 1; j >= 0; j--) {
+        if (j != windows - 1) {
+            for (int t = 0; t < job.c; t++) R = ecc_jacobian_double(R, curve);
+        }
+        R = ecc_jacobian_add(R, sums[j], curve);
     }
     return R;
 }
 
+ECC_Point ecc_multi_scalar_mult(const uint64* scalars, const ECC_Point* points, size_t count,
+                                ECC_Curve curve, int num_threads) {
+    return ecc_from_jacobian(ecc_jacobian_multi_scalar_mult(scalars, points, count, curve, num_threads), curve);
+}
+
+// ---  (SEC1) ---
+
+// ʱÿκϲĵ (ջϻ)
+#define ECC_ENCODE_BATCH 256
+
+// ģƽ: p = 3 (mod 4) ʱΪһģ a^((p+1)/4)p = 5 (mod 8)  Atkin ʽ
+//  (p = 1 mod 8)  Tonelli-ShanksƽȥУ飬a Ƕʣʱ false
+bool ecc_sqrt_mod(uint64 a, uint64 p, uint64* root) {
+    a %= p;
+    if (a == 0 || p == 2) {
+        *root = a;
+        return true;
+    }
+    uint64 r;
+    if ((p & 3) == 3) {
+        r = power(a, (p >> 2) + 1, p);
+    }
+    else if ((p & 7) == 5) {
+        // v = (2a)^((p-5)/8), i = 2a * v^2 (i^2 = -1)r = a * v * (i - 1)
+        uint64 a2 = add_mod(a, a, p);
+        uint64 v = power(a2, p >> 3, p);
+        uint64 i = mul_mod(a2, mul_mod(v, v, p), p);
+        r = mul_mod(mul_mod(a, v, p), fe_sub(i, 1, p), p);
+    }
+    else {
+        // p - 1 = q * 2^sz ΪһǶʣ
+        uint64 q = p - 1;
+        int s = 0;
+        while ((q & 1) == 0) { q >>= 1; s++; }
+        uint64 z = 2;
+        while (power(z, (p - 1) >> 1, p) != p - 1) z++;
+
+        uint64 c = power(z, q, p);
+        uint64 t = power(a, q, p);
+        r = power(a, (q + 1) >> 1, p);
+        int m = s;
+        while (t != 1) {
+            // С i ʹ t^(2^i) = 1i ﵽ m ˵ a Ƕʣ
+            int i = 0;
+            uint64 t2 = t;
+            while (t2 != 1) {
+                t2 = mul_mod(t2, t2, p);
+                if (++i == m) return false;
+            }
+            uint64 b = c;
+            for (int j = 0; j < m - i - 1; j++) b = mul_mod(b, b, p);
+            r = mul_mod(r, b, p);
+            c = mul_mod(b, b, p);
+            t = mul_mod(t, c, p);
+            m = i;
+        }
+    }
+    if (mul_mod(r, r, p) != a) return false;
+    *root = r;
+    return true;
+}
+
+size_t ecc_field_bytes(ECC_Curve curve) {
+    size_t len = 0;
+    for (uint64 v = curve.p; v != 0; v >>= 8) len++;
+    return len;
+}
+
+size_t ecc_point_encoded_size(ECC_Curve curve, bool compressed) {
+    size_t len = ecc_field_bytes(curve);
+    return compressed ? 1 + len : 1 + 2 * len;
+}
+
+// д / ȡ len ֽ
+static inline void put_be(uint8* out, uint64 v, size_t len) {
+    for (size_t i = len; i-- > 0;) {
+        out[i] = (uint8)v;
+        v >>= 8;
+    }
+}
+
+static inline uint64 get_be(const uint8* in, size_t len) {
+    uint64 v = 0;
+    for (size_t i = 0; i < len; i++) v = (v << 8) | in[i];
+    return v;
+}
+
+size_t ecc_point_encode(ECC_Point P, ECC_Curve curve, bool compressed, uint8* out, size_t out_len) {
+    if (P.is_infinity) {
+        if (out_len < 1) return 0;
+        out[0] = ECC_POINT_INFINITY;
+        return 1;
+    }
+    size_t len = ecc_field_bytes(curve);
+    size_t size = compressed ? 1 + len : 1 + 2 * len;
+    if (out_len < size) return 0;
+    out[0] = compressed ? (uint8)(ECC_POINT_COMPRESSED_EVEN | (P.y & 1)) : ECC_POINT_UNCOMPRESSED;
+    put_be(out + 1, P.x, len);
+    if (!compressed) put_be(out + 1 + len, P.y, len);
+    return size;
+}
+
+bool ecc_point_decode(const uint8* in, size_t in_len, ECC_Curve curve, ECC_Point* P) {
+    if (in_len == 0) return false;
+    P->x = 0;
+    P->y = 0;
+    P->is_infinity = false;
+
+    uint8 tag = in[0];
+    if (tag == ECC_POINT_INFINITY) {
+        for (size_t i = 1; i < in_len; i++) {
+            if (in[i] != 0) return false;
+        }
+        P->is_infinity = true;
+        return true;
+    }
+
+    size_t len = ecc_field_bytes(curve);
+    uint64 p = curve.p;
+    if ((tag == ECC_POINT_COMPRESSED_EVEN || tag == ECC_POINT_COMPRESSED_ODD) && in_len == 1 + len) {
+        uint64 x = get_be(in + 1, len);
+        if (x >= p) return false;
+        // y^2 = x^3 + ax + bǩѡȡż֮һµĸ
+        uint64 rhs = mul_mod(mul_mod(x, x, p), x, p);
+        rhs = add_mod(rhs, mul_mod(curve.a % p, x, p), p);
+        rhs = add_mod(rhs, curve.b % p, p);
+        uint64 y;
+        if (!ecc_sqrt_mod(rhs, p, &y)) return false;
+        if ((y & 1) != (uint64)(tag & 1)) {
+            if (y == 0) return false;
+            y = p - y;
+        }
+        P->x = x;
+        P->y = y;
+        return true;
+    }
+    if (tag == ECC_POINT_UNCOMPRESSED && in_len == 1 + 2 * len) {
+        uint64 x = get_be(in + 1, len);
+        uint64 y = get_be(in + 1 + len, len);
+        if (x >= p || y >= p) return false;
+        P->x = x;
+        P->y = y;
+        return ecc_is_on_curve(*P, curve);
+    }
+    return false;
+}
+
+size_t ecc_point_encode_batch(const ECC_JacobianPoint* in, size_t count, ECC_Curve curve, bool compressed, uint8* out) {
+    size_t size = ecc_point_encoded_size(curve, compressed);
+    ECC_Point affine[ECC_ENCODE_BATCH];
+    for (size_t start = 0; start < count; start += ECC_ENCODE_BATCH) {
+        size_t n = count - start < ECC_ENCODE_BATCH ? count - start : ECC_ENCODE_BATCH;
+        ecc_batch_normalize(in + start, affine, n, curve);
+        for (size_t j = 0; j < n; j++) {
+            uint8* slot = out + (start + j) * size;
+            size_t written = ecc_point_encode(affine[j], curve, compressed, slot, size);
+            for (size_t k = written; k < size; k++) slot[k] = 0;    // Զ: 0x00 㵽
+        }
+    }
+    return count * size;
+}
+
+// 3. ˷ R = k * P
+// ſɱɣֻתطʱһ
+// (ԭȵķ Double-and-Add ÿε / 㶼Ҫһ mod_inverse)
+ECC_Point ecc_scalar_mult(uint64 k, ECC_Point P, ECC_Curve curve) {
+    return ecc_from_jacobian(ecc_jacobian_scalar_mult(k, P, curve), curve);
+}
+
 // 4. Կ
 // Q = d * G
 bool ecc_generate_keys(ECC_Curve curve, ECC_Point G, uint64 d, ECC_PublicKey* pub, ECC_PrivateKey* priv) {
@@ -119,8 +803,8 @@ bool ecc_generate_keys(ECC_Curve curve, ECC_Point G, uint64 d, ECC_PublicKey* pu
         return false;
     }
 
-    // 㹫Կ Q = d * G
-    ECC_Point Q = ecc_scalar_mult(d, G, curve);
+    // 㹫Կ Q = d * G (̶)
+    ECC_Point Q = ecc_scalar_mult_base(d, G, curve);
 
     pub->curve = curve;
     pub->G = G;
@@ -140,8 +824,8 @@ ECC_Signature ecdsa_sign(uint64 hash, uint64 k, const ECC_PrivateKey* priv) {
     ECC_Signature sig = { 0, 0 };
     uint64 n = priv->curve.n;
 
-    //  R = k * G
-    ECC_Point R = ecc_scalar_mult(k, priv->G, priv->curve);
+    //  R = k * G (̶)
+    ECC_Point R = ecc_scalar_mult_base(k, priv->G, priv->curve);
 
     // r = R.x mod n
     sig.r = R.x % n;
@@ -152,15 +836,31 @@ ECC_Signature ecdsa_sign(uint64 hash, uint64 k, const ECC_PrivateKey* priv) {
 
     // s = k^(-1) * (hash + r*d) mod n
     uint64 k_inv = mod_inverse(k, n);
-    uint64 rd = (sig.r * priv->d) % n;
-    uint64 sum = (hash + rd) % n;
-    sig.s = (k_inv * sum) % n;
+    uint64 rd = mul_mod(sig.r, priv->d, n);
+    uint64 sum = add_mod(hash % n, rd, n);
+    sig.s = mul_mod(k_inv, sum, n);
 
     if (sig.s == 0) printf("Error: s = 0, choose different k.\n");
 
     return sig;
 }
 
+// 5b. ʹԤԪ ECDSA ǩ
+ECC_Signature ecdsa_sign_with_nonce(uint64 hash, const NONCE_TRIPLE* nonce, const ECC_PrivateKey* priv) {
+    ECC_Signature sig = { 0, 0 };
+    uint64 n = priv->curve.n;
+    if (nonce->r == 0 || nonce->k_inv == 0) {
+        printf("Error: Invalid nonce triple.\n");
+        return sig;
+    }
+
+    sig.r = nonce->r;
+    uint64 sum = add_mod(hash % n, mul_mod(sig.r, priv->d, n), n);
+    sig.s = mul_mod(nonce->k_inv, sum, n);
+    if (sig.s == 0) printf("Error: s = 0, choose different k.\n");
+    return sig;
+}
+
 // 6. ECDSA ǩ
 // w = s^(-1) mod n
 // u1 = hash * w mod n
@@ -168,30 +868,135 @@ ECC_Signature ecdsa_sign(uint64 hash, uint64 k, const ECC_PrivateKey* priv) {
 // P = u1*G + u2*Q
 // check P.x == r
 bool ecdsa_verify(uint64 hash, ECC_Signature sig, const ECC_PublicKey* pub) {
-    if (sig.r == 0 || sig.s == 0) return false;
     uint64 n = pub->curve.n;
+    if (sig.r == 0 || sig.s == 0 || sig.r >= n || sig.s >= n) return false;
 
     uint64 w = mod_inverse(sig.s, n);
-    uint64 u1 = (hash * w) % n;
-    uint64 u2 = (sig.r * w) % n;
+    uint64 u1 = mul_mod(hash % n, w, n);
+    uint64 u2 = mul_mod(sig.r, w, n);
 
-    // P = u1*G + u2*Q
-    ECC_Point P1 = ecc_scalar_mult(u1, pub->G, pub->curve);
-    ECC_Point P2 = ecc_scalar_mult(u2, pub->Q, pub->curve);
-    ECC_Point P = ecc_point_add(P1, P2, pub->curve);
+    // P = u1*G + u2*Q: һG һʹûĹ̶ֻһ
+    ECC_Point P = ecc_from_jacobian(ecc_jacobian_double_mult_base(u1, pub->G, u2, pub->Q, pub->curve), pub->curve);
 
     if (P.is_infinity) return false;
 
     return (P.x % n) == sig.r;
 }
 
+// 6b. ECDSA ǩ
+#define ECDSA_BATCH_PARALLEL_MIN 64
+
+typedef struct {
+    const uint64* hashes;
+    const ECC_Signature* sigs;
+    const ECC_PublicKey* pubs;
+    const uint64* w;            // s^(-1) mod n0 ʾǩʽǷ
+    const bool* shared;         // Ƿ pubs[0] ͬͬ ()
+    ECC_JacobianPoint* points;  // u1*G + u2*Q (ſɱ)
+    bool* ok;
+} ECDSA_VERIFY_JOB;
+
+static void ecdsa_verify_range(size_t begin, size_t end, void* arg) {
+    const ECDSA_VERIFY_JOB* job = (const ECDSA_VERIFY_JOB*)arg;
+    for (size_t i = begin; i < end; i++) {
+        const ECC_PublicKey* pub = &job->pubs[i];
+        ECC_JacobianPoint inf = { 1, 1, 0 };
+        job->points[i] = inf;
+        if (!job->shared[i]) {
+            job->ok[i] = ecdsa_verify(job->hashes[i], job->sigs[i], pub);
+            continue;
+        }
+        job->ok[i] = false;
+        uint64 w = job->w[i];
+        if (w == 0) continue;
+
+        uint64 n = pub->curve.n;
+        uint64 u1 = mul_mod(job->hashes[i] % n, w, n);
+        uint64 u2 = mul_mod(job->sigs[i].r, w, n);
+        job->points[i] = ecc_jacobian_double_mult_base(u1, pub->G, u2, pub->Q, pub->curve);
+    }
+}
+
+size_t ecdsa_verify_batch(const uint64* hashes, const ECC_Signature* sigs, const ECC_PublicKey* pubs,
+                          bool* results, size_t count, int num_threads) {
+    if (count == 0) return 0;
+    ECC_Curve curve = pubs[0].curve;
+    uint64 n = curve.n;
+    uint64 p = curve.p;
+
+    bool* ok = results ? results : new bool[count];
+    bool* shared = new bool[count];
+    uint64* w = new uint64[count];
+    ECC_JacobianPoint* points = new ECC_JacobianPoint[count];
+
+    // Montgomery : ֻ s ĳ˻һ棬ٴӺǰÿ s_i^(-1)
+    // ʽǷǩ 1 ˻Ϊ 0
+    uint64 acc = 1 % n;
+    for (size_t i = 0; i < count; i++) {
+        shared[i] = same_curve(pubs[i].curve, pubs[i].G, curve, pubs[0].G);
+        bool valid = shared[i] && sigs[i].r > 0 && sigs[i].r < n && sigs[i].s > 0 && sigs[i].s < n;
+        w[i] = acc; // ݴ s_0 * ... * s_(i-1)
+        if (valid) acc = mul_mod(acc, sigs[i].s, n);
+    }
+    uint64 inv = mod_inverse(acc, n);
+    for (size_t i = count; i-- > 0;) {
+        bool valid = shared[i] && sigs[i].r > 0 && sigs[i].r < n && sigs[i].s > 0 && sigs[i].s < n;
+        if (!valid || inv == 0) {
+            // inv == 0 ˵ n ˻
+            w[i] = valid ? mod_inverse(sigs[i].s, n) : 0;
+            continue;
+        }
+        uint64 prefix = w[i];
+        w[i] = mul_mod(inv, prefix, n);     // s_i^(-1) = (s_0..s_i)^(-1) * (s_0..s_(i-1))
+        inv = mul_mod(inv, sigs[i].s, n);   // ȥ s_iõ (s_0..s_(i-1))^(-1)
+    }
+
+    // ߳̽ G Ĺ̶ֻ߳
+    ecc_fixed_base_get(pubs[0].G, curve);
+
+    ECDSA_VERIFY_JOB job;
+    job.hashes = hashes;
+    job.sigs = sigs;
+    job.pubs = pubs;
+    job.w = w;
+    job.shared = shared;
+    job.points = points;
+    job.ok = ok;
+    if (count < ECDSA_BATCH_PARALLEL_MIN) num_threads = 1;
+    parallel_for(count, num_threads, ecdsa_verify_range, &job);
+
+    // н Z ϲΪһ (Z = 0 Զ㣬)x = X / Z^2 x mod n == r
+    // w[] ꣬ǰ׺
+    acc = 1 % p;
+    for (size_t i = 0; i < count; i++) {
+        w[i] = acc;
+        if (shared[i] && points[i].Z != 0) acc = mul_mod(acc, points[i].Z, p);
+    }
+    inv = mod_inverse(acc, p);
+    for (size_t i = count; i-- > 0;) {
+        if (!shared[i] || points[i].Z == 0) continue;
+        uint64 z_inv = mul_mod(inv, w[i], p);
+        inv = mul_mod(inv, points[i].Z, p);
+        uint64 x = mul_mod(points[i].X, mul_mod(z_inv, z_inv, p), p);
+        ok[i] = (x % n) == sigs[i].r;
+    }
+
+    size_t valid = 0;
+    for (size_t i = 0; i < count; i++) valid += ok[i] ? 1 : 0;
+    delete[] points;
+    delete[] w;
+    delete[] shared;
+    if (!results) delete[] ok;
+    return valid;
+}
+
 // 7. ECC-ElGamal 
 // C1 = kG
 // C2 = M + kQ (ӷ)
 ECC_Ciphertext ecc_encrypt(ECC_Point message, uint64 k, const ECC_PublicKey* pub) {
     ECC_Ciphertext ct;
-    // C1 = k * G
-    ct.C1 = ecc_scalar_mult(k, pub->G, pub->curve);
+    // C1 = k * G (̶)
+    ct.C1 = ecc_scalar_mult_base(k, pub->G, pub->curve);
 
     // S = k * Q (Shared Secret)
     ECC_Point S = ecc_scalar_mult(k, pub->Q, pub->curve);
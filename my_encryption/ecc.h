@@ -20,6 +20,46 @@ typedef struct {
     bool is_infinity; // ǷΪԶ (Ԫ)
 } ECC_Point;
 
+// ſɱµĵ: (X, Y, Z) ʾ (X/Z^2, Y/Z^3)Z = 0 ΪԶ
+//  / ȫó˷ɣҪ棬ֻתطʱһ
+typedef struct {
+    uint64 X;
+    uint64 Y;
+    uint64 Z;
+} ECC_JacobianPoint;
+
+// wNAF ر: 64 λ 65 з
+#define ECC_WNAF_MAX_DIGITS 65
+// ֵ֧󴰿ڿ (СΪ 2^(w-2))
+#define ECC_WNAF_MAX_WINDOW 6
+
+// ̶: ͬһ G  k*G ʱʹ
+// table[i * (2^w - 1) + d - 1] = d * 2^(w*i) * G ()k*G ֻ k ÿ w λڶӦıӣ
+// Լ 64/w λϵӣҪ㡣С ceil(64/w) * (2^w - 1) : w = 4 Լ 5.6KBw = 8 Լ 48KB
+#define ECC_FIXED_BASE_MIN_WINDOW 1
+#define ECC_FIXED_BASE_MAX_WINDOW 8
+#define ECC_FIXED_BASE_DEFAULT_WINDOW 4
+#define ECC_FIXED_BASE_CACHE_SIZE 16
+typedef struct {
+    ECC_Curve curve;
+    ECC_Point G;
+    int w;              // ڿ
+    int rows;           // ڸ ceil(64 / w)
+    ECC_Point* table;   // rows * (2^w - 1) 
+} ECC_FIXED_BASE_TABLE;
+
+// ˷ (Pippenger) 󴰿ڿÿӷĵ
+#define ECC_MSM_MAX_WINDOW 16
+#define ECC_MSM_BATCH 256
+
+// SEC1 ֽ: Զ / ѹ (y Ϊż / ) / δѹ
+// 갴 ceil(log2(p) / 8) ֽڴ˴ţp < 2^64 ʱδѹ 17 ֽ
+#define ECC_POINT_INFINITY 0x00
+#define ECC_POINT_COMPRESSED_EVEN 0x02
+#define ECC_POINT_COMPRESSED_ODD 0x03
+#define ECC_POINT_UNCOMPRESSED 0x04
+#define ECC_POINT_MAX_ENCODED_SIZE 17
+
 // ECC Կ (һ Q)
 typedef struct {
     ECC_Curve curve;
@@ -56,9 +96,140 @@ extern "C" {
     bool ecc_is_on_curve(ECC_Point P, ECC_Curve curve);
     // ӷ: R = P + Q
     ECC_Point ecc_point_add(ECC_Point P, ECC_Point Q, ECC_Curve curve);
-    // ˷: R = k * P
+    // ˷: R = k * P (ڲʹſɱֻ꣬һ)
     ECC_Point ecc_scalar_mult(uint64 k, ECC_Point P, ECC_Curve curve);
 
+    // --- 1b. ſɱ () ---
+    //  -> ſɱ (Z = 1)
+    ECC_JacobianPoint ecc_to_jacobian(ECC_Point P);
+    // ſɱ ->  (һ)
+    ECC_Point ecc_from_jacobian(ECC_JacobianPoint P, ECC_Curve curve);
+    // : R = 2P
+    ECC_JacobianPoint ecc_jacobian_double(ECC_JacobianPoint P, ECC_Curve curve);
+    // : R = P + Q
+    ECC_JacobianPoint ecc_jacobian_add(ECC_JacobianPoint P, ECC_JacobianPoint Q, ECC_Curve curve);
+    // ϵ: R = P + QQ Ϊ (Z = 1һʡ 4 γ˷)
+    ECC_JacobianPoint ecc_jacobian_add_affine(ECC_JacobianPoint P, ECC_Point Q, ECC_Curve curve);
+    /**
+     * ſɱ ->  (Montgomery ): count  Z һ棬ÿԼ 6 γ˷
+     * ǰ׺ݴ out Уڴ棻Z = 0 ĵΪԶ
+     * @param in / out: ص
+     */
+    void ecc_batch_normalize(const ECC_JacobianPoint* in, ECC_Point* out, size_t count, ECC_Curve curve);
+    // ˷ſɱ (ڼۼ)
+    // ڲʹ wNAFڿȰ k λԶѡ
+    ECC_JacobianPoint ecc_jacobian_scalar_mult(uint64 k, ECC_Point P, ECC_Curve curve);
+
+    // --- 1c. wNAF ˷ ---
+    /**
+     *  w ķʽ (wNAF) ر
+     * ÿֶ |d| < 2^(w-1) w һ
+     * @param digits: λǰ ECC_WNAF_MAX_DIGITS 
+     * @return ָ (k = 0 ʱΪ 0)
+     */
+    int ecc_wnaf_recode(uint64 k, int w, int* digits);
+
+    // ݱλѡ񴰿ڿ
+    int ecc_wnaf_window(uint64 k);
+
+    /**
+     * ָڿȵ wNAF ˷
+     * Ԥ P, 3P, ..., (2^(w-1)-1)P һתΪ꣬
+     * ֱȡ (x, -y)ѭֻбͻϵ
+     * @param w: ڿ 2 ~ ECC_WNAF_MAX_WINDOW
+     */
+    ECC_JacobianPoint ecc_jacobian_scalar_mult_wnaf(uint64 k, ECC_Point P, int w, ECC_Curve curve);
+
+    // --- 1d. ̶˷ (ԿɡECDSA ǩECC-ElGamal е k*G) ---
+    /**
+     * : Լ 64 * 2^w / w εӣȫһתΪ
+     * @param w: ڿ ECC_FIXED_BASE_MIN_WINDOW ~ ECC_FIXED_BASE_MAX_WINDOWԽԽ졢ռڴԽ
+     * @return: Ϸڴʧʱ false
+     */
+    bool ecc_fixed_base_init(ECC_FIXED_BASE_TABLE* table, ECC_Point G, ECC_Curve curve, int w);
+    // ͷ ecc_fixed_base_init ı (Ҫ ecc_fixed_base_get صĻ)
+    void ecc_fixed_base_free(ECC_FIXED_BASE_TABLE* table);
+    //  k*Gſɱ
+    ECC_JacobianPoint ecc_fixed_base_mult(const ECC_FIXED_BASE_TABLE* table, uint64 k);
+
+    /**
+     * ֮½Ĵڿ (Ĭ ECC_FIXED_BASE_DEFAULT_WINDOW)
+     * ѽıӰ죻ڿȲͬıֱ𻺴
+     * @return: óɹ true
+     */
+    bool ecc_fixed_base_set_window(int w);
+
+    /**
+     * ȡ (curve, G, ǰڿ) Ӧȫֻʱ
+     * ౣ ECC_FIXED_BASE_CACHE_SIZE űһͷţصָһֱЧ
+     * @return:  G ΪԶʱ NULL
+     */
+    const ECC_FIXED_BASE_TABLE* ecc_fixed_base_get(ECC_Point G, ECC_Curve curve);
+
+    //  ecc_scalar_mult(k, G, curve) ͬʹû治ʱ˻ wNAF
+    ECC_Point ecc_scalar_mult_base(uint64 k, ECC_Point G, ECC_Curve curve);
+
+    // --- 1e. ˫˷ u1*P1 + u2*P2 (Shamir / Straus ECDSA ǩ) ---
+    /**
+     *  wNAF ر󽻴һ
+     * ֱʡԼһ뱶
+     */
+    ECC_JacobianPoint ecc_jacobian_double_mult(uint64 u1, ECC_Point P1, uint64 u2, ECC_Point P2, ECC_Curve curve);
+
+    /**
+     * u1*G + u2*QG Ϊ̶: G һֱʹû̶ 0 Ϊ w+1  wNAF 
+     * 治ʱ˻ ecc_jacobian_double_mult
+     */
+    ECC_JacobianPoint ecc_jacobian_double_mult_base(uint64 u1, ECC_Point G, uint64 u2, ECC_Point Q, ECC_Curve curve);
+
+    // --- 1f. ˷ sum(k_i * P_i) (Pippenger Ͱھۺ) ---
+    /**
+     *  c λз֣ÿڰѵ㰴ַŽ 2^c - 1 Ͱ
+     * Ͱۼӷ (ÿ ECC_MSM_BATCH μӷһ)
+     * ǰ׺ sum(d * B_d)Ѹڽ 2^c ϲ
+     * ڿȰλĵ㿪ѡ񣬸ڷָ̳߳زۼ
+     * @param num_threads: ʹõ߳; <= 0 ʾʹȫ
+     */
+    ECC_JacobianPoint ecc_jacobian_multi_scalar_mult(const uint64* scalars, const ECC_Point* points, size_t count,
+                                                     ECC_Curve curve, int num_threads);
+    // ͬϣתط
+    ECC_Point ecc_multi_scalar_mult(const uint64* scalars, const ECC_Point* points, size_t count,
+                                    ECC_Curve curve, int num_threads);
+
+    // --- 1g.  (SEC1: 0x04 || x || y  0x02/0x03 || x) ---
+    /**
+     * ģƽ:  r ʹ r^2 = a (mod p)p Ϊ
+     * p = 3 (mod 4) ʱֻһģݣp = 5 (mod 8)  Atkin ʽ Tonelli-Shanks
+     * @return: a Ƕʣʱ false
+     */
+    bool ecc_sqrt_mod(uint64 a, uint64 p, uint64* root);
+
+    // ֽ ceil(log2(p) / 8)
+    size_t ecc_field_bytes(ECC_Curve curve);
+    // ޵ı볤: ѹ 1 + Lδѹ 1 + 2L (Զֻռ 1 ֽ)
+    size_t ecc_point_encoded_size(ECC_Curve curve, bool compressed);
+
+    /**
+     * һ㣬д÷
+     * @return: дֽ; out_len ʱ 0
+     */
+    size_t ecc_point_encode(ECC_Point P, ECC_Curve curve, bool compressed, uint8* out, size_t out_len);
+
+    /**
+     * 벢У: ǩƥ䣬С pδѹϣ
+     * ѹ x ƽָ y ǩѡż0x00 (ɸȫ 0 ) ΪԶ
+     * @return: Ƿ㲻ʱ false
+     */
+    bool ecc_point_decode(const uint8* in, size_t in_len, ECC_Curve curve, ECC_Point* P);
+
+    /**
+     *  (繫Կ): ſɱĵÿ 256 ϲһתΪ
+     *  i д out + i * ecc_point_encoded_size(curve, compressed)Զд 0x00 
+     * @param out:  count * ecc_point_encoded_size(curve, compressed) ֽ
+     * @return: дֽ
+     */
+    size_t ecc_point_encode_batch(const ECC_JacobianPoint* in, size_t count, ECC_Curve curve, bool compressed, uint8* out);
+
     // --- 2. Կ ---
     // Կ
     bool ecc_generate_keys(ECC_Curve curve, ECC_Point G, uint64 d, ECC_PublicKey* pub, ECC_PrivateKey* priv);
@@ -66,9 +237,23 @@ extern "C" {
     // --- 3. ECDSA ǩ/ǩ ---
     // ǩ: hash ϢժҪʾk ʱ
     ECC_Signature ecdsa_sign(uint64 hash, uint64 k, const ECC_PrivateKey* priv);
+    // ǩ (ʹԤԪ): r  k^(-1) ãֻʣģ
+    ECC_Signature ecdsa_sign_with_nonce(uint64 hash, const NONCE_TRIPLE* nonce, const ECC_PrivateKey* priv);
     // ǩ
     bool ecdsa_verify(uint64 hash, ECC_Signature sig, const ECC_PublicKey* pub);
 
+    /**
+     * ǩ:  i Ϊ (hashes[i], sigs[i], pubs[i])ԿԸͬ
+     *  pubs[0] ͬͬǩ:  s^(-1) mod n ϲΪһ棬
+     * u1*G + u2*Q ָ̳߳ؼ㣬õſɱȵٺϲΪһתطꣻ
+     * ǩ ecdsa_verify
+     * @param results: ÿǩ֤ (Ϊ NULL)һεüɵõʧ
+     * @param num_threads: ʹõ߳; <= 0 ʾʹȫ
+     * @return: ֤ͨǩ
+     */
+    size_t ecdsa_verify_batch(const uint64* hashes, const ECC_Signature* sigs, const ECC_PublicKey* pubs,
+                              bool* results, size_t count, int num_threads);
+
     // --- 4. ECC-ElGamal / ---
     // ע:  message ϵһ M
     // ͨӳ䵽ǺܸӵḶ́ѧǼϢѾǵ M
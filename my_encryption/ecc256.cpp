@@ -0,0 +1,953 @@
+#include "ecc256.h"
+#include <stdio.h>
+#include <string.h>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+// --- limb  ---
+
+//  a * b ĵ 64 λ 64 λд *hi
+static inline uint64 mul64(uint64 a, uint64 b, uint64* hi) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = (unsigned __int128)a * b;
+    *hi = (uint64)(r >> 64);
+    return (uint64)r;
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, hi);
+#else
+    uint64 a_lo = (uint32)a, a_hi = a >> 32;
+    uint64 b_lo = (uint32)b, b_hi = b >> 32;
+    uint64 p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo, p3 = a_hi * b_hi;
+    uint64 mid = (p0 >> 32) + (uint32)p1 + (uint32)p2;
+    *hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32)p0;
+#endif
+}
+
+// a * b + c + d (ᳬ 128 λ) 64 λأ 64 λд *hi
+static inline uint64 mac(uint64 a, uint64 b, uint64 c, uint64 d, uint64* hi) {
+    uint64 h, l = mul64(a, b, &h);
+    l += c; h += (l < c);
+    l += d; h += (l < d);
+    *hi = h;
+    return l;
+}
+
+// λ / λλ / λָͨ봫봫 (0  1)
+static inline uint64 addc(uint64 a, uint64 b, uint64* carry) {
+    uint64 s = a + *carry;
+    uint64 c1 = (s < a);
+    uint64 r = s + b;
+    *carry = c1 | (r < s);
+    return r;
+}
+
+static inline uint64 subb(uint64 a, uint64 b, uint64* borrow) {
+    uint64 d = a - *borrow;
+    uint64 b1 = (a < *borrow);
+    uint64 r = d - b;
+    *borrow = b1 | (d < b);
+    return r;
+}
+
+static inline uint64 add4(uint64 r[4], const uint64 a[4], const uint64 b[4]) {
+    uint64 c = 0;
+    for (int i = 0; i < 4; i++) r[i] = addc(a[i], b[i], &c);
+    return c;
+}
+
+static inline uint64 sub4(uint64 r[4], const uint64 a[4], const uint64 b[4]) {
+    uint64 c = 0;
+    for (int i = 0; i < 4; i++) r[i] = subb(a[i], b[i], &c);
+    return c;
+}
+
+static inline int cmp4(const uint64 a[4], const uint64 b[4]) {
+    for (int i = 3; i >= 0; i--) {
+        if (a[i] != b[i]) return a[i] > b[i] ? 1 : -1;
+    }
+    return 0;
+}
+
+// hi * 2^256 + r >= p ʱȥһ p (Ҫ < 2p)ѡݷ֧
+static inline void reduce_once(uint64 r[4], uint64 hi, const uint64 p[4]) {
+    uint64 d[4];
+    uint64 borrow = sub4(d, r, p);
+    uint64 keep = (uint64)0 - (borrow & (hi ^ 1));
+    for (int i = 0; i < 4; i++) r[i] = (r[i] & keep) | (d[i] & ~keep);
+}
+
+// 512 λ˻ t = a * b
+static inline void mul_4x4(uint64 t[8], const uint64 a[4], const uint64 b[4]) {
+    for (int i = 0; i < 8; i++) t[i] = 0;
+    for (int i = 0; i < 4; i++) {
+        uint64 carry = 0;
+        for (int j = 0; j < 4; j++) t[i + j] = mac(a[i], b[j], t[i + j], carry, &carry);
+        t[i + 4] = carry;
+    }
+}
+
+// 512 λƽ: ֻһһλ
+static inline void sqr_4x4(uint64 t[8], const uint64 a[4]) {
+    for (int i = 0; i < 8; i++) t[i] = 0;
+    for (int i = 0; i < 3; i++) {
+        uint64 carry = 0;
+        for (int j = i + 1; j < 4; j++) t[i + j] = mac(a[i], a[j], t[i + j], carry, &carry);
+        t[i + 4] = carry;
+    }
+    uint64 top = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64 next = t[i] >> 63;
+        t[i] = (t[i] << 1) | top;
+        top = next;
+    }
+    uint64 carry = 0;
+    for (int i = 0; i < 4; i++) {
+        uint64 hi, lo = mul64(a[i], a[i], &hi);
+        t[2 * i] = addc(t[2 * i], lo, &carry);
+        t[2 * i + 1] = addc(t[2 * i + 1], hi, &carry);
+    }
+}
+
+// --- 1. 256 λ ---
+
+void fe256_from_bytes(FE256* r, const uint8 in[32]) {
+    for (int i = 0; i < 4; i++) {
+        uint64 w = 0;
+        for (int j = 0; j < 8; j++) w = (w << 8) | in[(3 - i) * 8 + j];
+        r->v[i] = w;
+    }
+}
+
+void fe256_to_bytes(uint8 out[32], const FE256* a) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 8; j++) out[(3 - i) * 8 + j] = (uint8)(a->v[i] >> (56 - 8 * j));
+    }
+}
+
+bool fe256_from_hex(FE256* r, const char* hex) {
+    size_t len = strlen(hex);
+    if (len == 0 || len > 64) return false;
+    memset(r, 0, sizeof(FE256));
+    for (size_t i = 0; i < len; i++) {
+        char c = hex[len - 1 - i];
+        uint64 d;
+        if (c >= '0' && c <= '9') d = (uint64)(c - '0');
+        else if (c >= 'a' && c <= 'f') d = (uint64)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') d = (uint64)(c - 'A' + 10);
+        else return false;
+        r->v[i / 16] |= d << (4 * (i % 16));
+    }
+    return true;
+}
+
+int fe256_cmp(const FE256* a, const FE256* b) {
+    return cmp4(a->v, b->v);
+}
+
+bool fe256_is_zero(const FE256* a) {
+    return (a->v[0] | a->v[1] | a->v[2] | a->v[3]) == 0;
+}
+
+// --- 2.  ---
+
+static const FE256 P256_P = { { 0xFFFFFFFFFFFFFFFFULL, 0x00000000FFFFFFFFULL, 0x0000000000000000ULL, 0xFFFFFFFF00000001ULL } };
+static const FE256 SECP256K1_P = { { 0xFFFFFFFEFFFFFC2FULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL } };
+#define SECP256K1_C 0x1000003D1ULL // 2^256 mod p = 2^32 + 977
+
+// secp256k1: t = hi * 2^256 + lo = lo + hi * (2^32 + 977)۵κټһ p
+static void reduce_secp256k1(uint64 r[4], const uint64 t[8], const uint64 p[4]) {
+    uint64 carry = 0;
+    for (int i = 0; i < 4; i++) r[i] = mac(t[4 + i], SECP256K1_C, t[i], carry, &carry);
+
+    // carry < 2^34carry * C < 2^67
+    uint64 hi, lo = mul64(carry, SECP256K1_C, &hi);
+    uint64 c = 0;
+    r[0] = addc(r[0], lo, &c);
+    r[1] = addc(r[1], hi, &c);
+    r[2] = addc(r[2], 0, &c);
+    r[3] = addc(r[3], 0, &c);
+
+    //  2^256 (c = 0  1) ۵һΣʱλСٽλ
+    uint64 fold = SECP256K1_C & ((uint64)0 - c);
+    c = 0;
+    r[0] = addc(r[0], fold, &c);
+    r[1] = addc(r[1], 0, &c);
+    r[2] = addc(r[2], 0, &c);
+    r[3] = addc(r[3], 0, &c);
+    reduce_once(r, 0, p);
+}
+
+// P-256 ר Montgomery Լ: r = t * 2^(-256) mod pt < 2^256 * p
+// p = 2^256 - 2^224 + 2^192 + 2^96 - 1  -p^(-1) = 1 (mod 2^64)ÿ m  limb
+//  p ĵ limb Ϊ 2^96 - 1 limb Ϊ 0m * p ֻһ 64 λ˷ (m * p[3]) λ
+static void reduce_p256(uint64 r[4], uint64 t[8], const uint64 p[4]) {
+    uint64 top = 0;
+    for (int i = 0; i < 4; i++) {
+        // t += m * p * 2^(64i) t[i] + m * (2^96 - 1) ĵ 64 λΪ 0
+        // һĽλ top ڱֵ t[i + 4]hi < p[3]  hi + top 
+        uint64 m = t[i], c = 0, hi;
+        uint64 lo = mul64(m, p[3], &hi);
+        t[i + 1] = addc(t[i + 1], m << 32, &c);
+        t[i + 2] = addc(t[i + 2], m >> 32, &c);
+        t[i + 3] = addc(t[i + 3], lo, &c);
+        t[i + 4] = addc(t[i + 4], hi + top, &c);
+        top = c;
+    }
+
+    //  top * 2^256 + t[4..7] < 2pһ p
+    for (int i = 0; i < 4; i++) r[i] = t[4 + i];
+    reduce_once(r, top, p);
+}
+
+// Montgomery Լ (CIOS): r = a * b * 2^(-256) mod p
+static void mont_mul256(uint64 r[4], const uint64 a[4], const uint64 b[4], const uint64 p[4], uint64 n0) {
+    uint64 t[6] = { 0, 0, 0, 0, 0, 0 };
+    for (int i = 0; i < 4; i++) {
+        uint64 carry = 0;
+        for (int j = 0; j < 4; j++) t[j] = mac(a[j], b[i], t[j], carry, &carry);
+        uint64 c = 0;
+        t[4] = addc(t[4], carry, &c);
+        t[5] = c;
+
+        uint64 m = t[0] * n0;
+        mac(m, p[0], t[0], 0, &carry); //  64 λΪ 0
+        for (int j = 1; j < 4; j++) t[j - 1] = mac(m, p[j], t[j], carry, &carry);
+        c = 0;
+        t[3] = addc(t[4], carry, &c);
+        t[4] = t[5] + c;
+    }
+    for (int i = 0; i < 4; i++) r[i] = t[i];
+    reduce_once(r, t[4], p);
+}
+
+void field256_init(FIELD256* f, const FE256* p) {
+    f->p = *p;
+    if (fe256_cmp(p, &P256_P) == 0) f->kind = FIELD256_P256;
+    else if (fe256_cmp(p, &SECP256K1_P) == 0) f->kind = FIELD256_SECP256K1;
+    else f->kind = FIELD256_GENERIC;
+
+    // n0 = -p^(-1) mod 2^64 (Newton ÿЧλ)
+    uint64 inv = 1;
+    for (int i = 0; i < 6; i++) inv *= 2 - p->v[0] * inv;
+    f->n0 = (uint64)0 - inv;
+
+    // R^2 mod p:  1 ʼģӱ 512 
+    FE256 x = { { 1, 0, 0, 0 } };
+    for (int i = 0; i < 512; i++) {
+        uint64 c = add4(x.v, x.v, x.v);
+        if (c || cmp4(x.v, p->v) >= 0) sub4(x.v, x.v, p->v);
+    }
+    f->r2 = x;
+
+    FE256 one = { { 1, 0, 0, 0 } };
+    field256_to(f, &f->one, &one);
+}
+
+void field256_to(const FIELD256* f, FE256* r, const FE256* a) {
+    if (f->kind == FIELD256_SECP256K1) *r = *a;
+    else field256_mul(f, r, a, &f->r2);
+}
+
+void field256_from(const FIELD256* f, FE256* r, const FE256* a) {
+    if (f->kind == FIELD256_GENERIC) {
+        const uint64 one[4] = { 1, 0, 0, 0 };
+        mont_mul256(r->v, a->v, one, f->p.v, f->n0);
+    }
+    else if (f->kind == FIELD256_P256) {
+        uint64 t[8] = { a->v[0], a->v[1], a->v[2], a->v[3], 0, 0, 0, 0 };
+        reduce_p256(r->v, t, f->p.v);
+    }
+    else {
+        *r = *a;
+    }
+}
+
+void field256_add(const FIELD256* f, FE256* r, const FE256* a, const FE256* b) {
+    uint64 c = add4(r->v, a->v, b->v);
+    reduce_once(r->v, c, f->p.v);
+}
+
+void field256_sub(const FIELD256* f, FE256* r, const FE256* a, const FE256* b) {
+    uint64 mask = (uint64)0 - sub4(r->v, a->v, b->v);
+    uint64 pm[4];
+    for (int i = 0; i < 4; i++) pm[i] = f->p.v[i] & mask;
+    add4(r->v, r->v, pm);
+}
+
+void field256_mul(const FIELD256* f, FE256* r, const FE256* a, const FE256* b) {
+    if (f->kind == FIELD256_GENERIC) {
+        mont_mul256(r->v, a->v, b->v, f->p.v, f->n0);
+        return;
+    }
+    uint64 t[8];
+    mul_4x4(t, a->v, b->v);
+    if (f->kind == FIELD256_P256) reduce_p256(r->v, t, f->p.v);
+    else reduce_secp256k1(r->v, t, f->p.v);
+}
+
+void field256_sqr(const FIELD256* f, FE256* r, const FE256* a) {
+    if (f->kind == FIELD256_GENERIC) {
+        mont_mul256(r->v, a->v, a->v, f->p.v, f->n0);
+        return;
+    }
+    uint64 t[8];
+    sqr_4x4(t, a->v);
+    if (f->kind == FIELD256_P256) reduce_p256(r->v, t, f->p.v);
+    else reduce_secp256k1(r->v, t, f->p.v);
+}
+
+// Fermat С: a^(-1) = a^(p-2)Ӹλʼƽ-
+void field256_inv(const FIELD256* f, FE256* r, const FE256* a) {
+    FE256 e = f->p;
+    const uint64 two[4] = { 2, 0, 0, 0 };
+    sub4(e.v, e.v, two);
+
+    FE256 base = *a;
+    FE256 acc = f->one;
+    for (int i = 255; i >= 0; i--) {
+        field256_sqr(f, &acc, &acc);
+        if ((e.v[i / 64] >> (i % 64)) & 1) field256_mul(f, &acc, &acc, &base);
+    }
+    *r = acc;
+}
+
+// r = 2a
+static inline void fe_dbl(const FIELD256* f, FE256* r, const FE256* a) { field256_add(f, r, a, a); }
+
+// --- 3.  ---
+
+void ecc256_to_jacobian(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const ECC256_Point* P) {
+    if (P->is_infinity) {
+        memset(R, 0, sizeof(*R));
+        R->X = curve->field.one;
+        R->Y = curve->field.one;
+        return;
+    }
+    field256_to(&curve->field, &R->X, &P->x);
+    field256_to(&curve->field, &R->Y, &P->y);
+    R->Z = curve->field.one;
+}
+
+void ecc256_from_jacobian(const ECC256_Curve* curve, ECC256_Point* R, const ECC256_JacobianPoint* P) {
+    const FIELD256* f = &curve->field;
+    if (fe256_is_zero(&P->Z)) {
+        memset(R, 0, sizeof(*R));
+        R->is_infinity = true;
+        return;
+    }
+    FE256 z_inv, z_inv2, z_inv3, x, y;
+    field256_inv(f, &z_inv, &P->Z);
+    field256_sqr(f, &z_inv2, &z_inv);
+    field256_mul(f, &z_inv3, &z_inv2, &z_inv);
+    field256_mul(f, &x, &P->X, &z_inv2);
+    field256_mul(f, &y, &P->Y, &z_inv3);
+    field256_from(f, &R->x, &x);
+    field256_from(f, &R->y, &y);
+    R->is_infinity = false;
+}
+
+static inline void set_infinity(const ECC256_Curve* curve, ECC256_JacobianPoint* R) {
+    R->X = curve->field.one;
+    R->Y = curve->field.one;
+    memset(&R->Z, 0, sizeof(FE256));
+}
+
+// : S = 4XY^2, M = 3X^2 + aZ^4, X3 = M^2 - 2S, Y3 = M(S - X3) - 8Y^4, Z3 = 2YZ
+// a = -3 ʱ M = 3(X - Z^2)(X + Z^2)a = 0 ʱ M = 3X^2
+// ʽ岻֧: P ΪԶ (Z = 0)  Y = 0 ʱ Z3 = 2YZ = 0ԱʾԶ
+static void double_formula(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const ECC256_JacobianPoint* P) {
+    const FIELD256* f = &curve->field;
+    FE256 YY, S, M, t, X3, Y3, Z3;
+    field256_sqr(f, &YY, &P->Y);
+    field256_mul(f, &S, &P->X, &YY);
+    fe_dbl(f, &S, &S);
+    fe_dbl(f, &S, &S);
+
+    if (curve->a_kind == ECC256_A_MINUS3) {
+        FE256 ZZ, u, v;
+        field256_sqr(f, &ZZ, &P->Z);
+        field256_sub(f, &u, &P->X, &ZZ);
+        field256_add(f, &v, &P->X, &ZZ);
+        field256_mul(f, &t, &u, &v);
+        field256_add(f, &M, &t, &t);
+        field256_add(f, &M, &M, &t);
+    }
+    else {
+        field256_sqr(f, &t, &P->X);
+        field256_add(f, &M, &t, &t);
+        field256_add(f, &M, &M, &t);
+        if (curve->a_kind == ECC256_A_GENERIC) {
+            FE256 ZZ;
+            field256_sqr(f, &ZZ, &P->Z);
+            field256_sqr(f, &ZZ, &ZZ);
+            field256_mul(f, &t, &ZZ, &curve->a);
+            field256_add(f, &M, &M, &t);
+        }
+    }
+
+    field256_sqr(f, &X3, &M);
+    fe_dbl(f, &t, &S);
+    field256_sub(f, &X3, &X3, &t);
+
+    field256_mul(f, &Z3, &P->Y, &P->Z);
+    fe_dbl(f, &Z3, &Z3);
+
+    field256_sqr(f, &t, &YY);   // Y^4
+    fe_dbl(f, &t, &t);
+    fe_dbl(f, &t, &t);
+    fe_dbl(f, &t, &t);          // 8Y^4
+    field256_sub(f, &Y3, &S, &X3);
+    field256_mul(f, &Y3, &Y3, &M);
+    field256_sub(f, &Y3, &Y3, &t);
+
+    R->X = X3;
+    R->Y = Y3;
+    R->Z = Z3;
+}
+
+void ecc256_jacobian_double(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const ECC256_JacobianPoint* P) {
+    if (fe256_is_zero(&P->Z) || fe256_is_zero(&P->Y)) {
+        set_infinity(curve, R);
+        return;
+    }
+    double_formula(curve, R, P);
+}
+
+// : U1 = X1 Z2^2, U2 = X2 Z1^2, S1 = Y1 Z2^3, S2 = Y2 Z1^3, H = U2 - U1, r = S2 - S1
+// X3 = r^2 - H^3 - 2 U1 H^2, Y3 = r (U1 H^2 - X3) - S1 H^3, Z3 = Z1 Z2 H
+// ʽ岻֧ P  Q ΪԶԼ P = Q (ʱ H = 0)Hr ж
+static void add_formula(const ECC256_Curve* curve, ECC256_JacobianPoint* R, FE256* H, FE256* r,
+                        const ECC256_JacobianPoint* P, const ECC256_JacobianPoint* Q) {
+    const FIELD256* f = &curve->field;
+    FE256 Z1Z1, Z2Z2, U1, U2, S1, S2, t;
+    field256_sqr(f, &Z1Z1, &P->Z);
+    field256_sqr(f, &Z2Z2, &Q->Z);
+    field256_mul(f, &U1, &P->X, &Z2Z2);
+    field256_mul(f, &U2, &Q->X, &Z1Z1);
+    field256_mul(f, &t, &Q->Z, &Z2Z2);
+    field256_mul(f, &S1, &P->Y, &t);
+    field256_mul(f, &t, &P->Z, &Z1Z1);
+    field256_mul(f, &S2, &Q->Y, &t);
+    field256_sub(f, H, &U2, &U1);
+    field256_sub(f, r, &S2, &S1);
+
+    FE256 HH, HHH, V, X3, Y3, Z3;
+    field256_sqr(f, &HH, H);
+    field256_mul(f, &HHH, H, &HH);
+    field256_mul(f, &V, &U1, &HH);
+
+    field256_sqr(f, &X3, r);
+    field256_sub(f, &X3, &X3, &HHH);
+    fe_dbl(f, &t, &V);
+    field256_sub(f, &X3, &X3, &t);
+
+    field256_sub(f, &Y3, &V, &X3);
+    field256_mul(f, &Y3, &Y3, r);
+    field256_mul(f, &t, &S1, &HHH);
+    field256_sub(f, &Y3, &Y3, &t);
+
+    field256_mul(f, &Z3, &P->Z, &Q->Z);
+    field256_mul(f, &Z3, &Z3, H);
+
+    R->X = X3;
+    R->Y = Y3;
+    R->Z = Z3;
+}
+
+void ecc256_jacobian_add(const ECC256_Curve* curve, ECC256_JacobianPoint* R,
+                         const ECC256_JacobianPoint* P, const ECC256_JacobianPoint* Q) {
+    if (fe256_is_zero(&P->Z)) { *R = *Q; return; }
+    if (fe256_is_zero(&Q->Z)) { *R = *P; return; }
+
+    ECC256_JacobianPoint T;
+    FE256 H, r;
+    add_formula(curve, &T, &H, &r, P, Q);
+    if (fe256_is_zero(&H)) {
+        if (fe256_is_zero(&r)) ecc256_jacobian_double(curve, R, P);
+        else set_infinity(curve, R);
+        return;
+    }
+    *R = T;
+}
+
+// ϵӹʽ: Q Ϊ (ΪڱʾZ = 1)κη֧
+//  P  Q ΪԶԼ P = Q (ʱ H = 0)Hr ж
+static void add_affine_formula(const ECC256_Curve* curve, ECC256_JacobianPoint* R, FE256* H, FE256* r,
+                               const ECC256_JacobianPoint* P, const ECC256_Point* Q) {
+    const FIELD256* f = &curve->field;
+    FE256 Z1Z1, U2, S2, t;
+    field256_sqr(f, &Z1Z1, &P->Z);
+    field256_mul(f, &U2, &Q->x, &Z1Z1);
+    field256_mul(f, &t, &P->Z, &Z1Z1);
+    field256_mul(f, &S2, &Q->y, &t);
+    field256_sub(f, H, &U2, &P->X);
+    field256_sub(f, r, &S2, &P->Y);
+
+    FE256 HH, HHH, V, X3, Y3, Z3;
+    field256_sqr(f, &HH, H);
+    field256_mul(f, &HHH, H, &HH);
+    field256_mul(f, &V, &P->X, &HH);
+
+    field256_sqr(f, &X3, r);
+    field256_sub(f, &X3, &X3, &HHH);
+    fe_dbl(f, &t, &V);
+    field256_sub(f, &X3, &X3, &t);
+
+    field256_sub(f, &Y3, &V, &X3);
+    field256_mul(f, &Y3, &Y3, r);
+    field256_mul(f, &t, &P->Y, &HHH);
+    field256_sub(f, &Y3, &Y3, &t);
+
+    field256_mul(f, &Z3, &P->Z, H);
+
+    R->X = X3;
+    R->Y = Y3;
+    R->Z = Z3;
+}
+
+// ϵ: Q Ϊ (ΪڱʾZ = 1)
+static void jacobian_add_affine(const ECC256_Curve* curve, ECC256_JacobianPoint* R,
+                                const ECC256_JacobianPoint* P, const ECC256_Point* Q) {
+    const FIELD256* f = &curve->field;
+    if (Q->is_infinity) { *R = *P; return; }
+    if (fe256_is_zero(&P->Z)) {
+        R->X = Q->x;
+        R->Y = Q->y;
+        R->Z = f->one;
+        return;
+    }
+
+    ECC256_JacobianPoint T;
+    FE256 H, r;
+    add_affine_formula(curve, &T, &H, &r, P, Q);
+    if (fe256_is_zero(&H)) {
+        if (fe256_is_zero(&r)) ecc256_jacobian_double(curve, R, P);
+        else set_infinity(curve, R);
+        return;
+    }
+    *R = T;
+}
+
+bool ecc256_is_on_curve(const ECC256_Curve* curve, const ECC256_Point* P) {
+    if (P->is_infinity) return true;
+    const FIELD256* f = &curve->field;
+    if (fe256_cmp(&P->x, &f->p) >= 0 || fe256_cmp(&P->y, &f->p) >= 0) return false;
+
+    FE256 x, y, lhs, rhs, t;
+    field256_to(f, &x, &P->x);
+    field256_to(f, &y, &P->y);
+    field256_sqr(f, &lhs, &y);
+    field256_sqr(f, &rhs, &x);
+    field256_add(f, &rhs, &rhs, &curve->a);
+    field256_mul(f, &rhs, &rhs, &x);       // x^3 + ax
+    field256_add(f, &rhs, &rhs, &curve->b);
+    field256_sub(f, &t, &lhs, &rhs);
+    return fe256_is_zero(&t);
+}
+
+void ecc256_point_add(const ECC256_Curve* curve, ECC256_Point* R, const ECC256_Point* P, const ECC256_Point* Q) {
+    ECC256_JacobianPoint JP, JQ, JR;
+    ecc256_to_jacobian(curve, &JP, P);
+    ecc256_to_jacobian(curve, &JQ, Q);
+    ecc256_jacobian_add(curve, &JR, &JP, &JQ);
+    ecc256_from_jacobian(curve, R, &JR);
+}
+
+// wNAF ر (256 λ 257 )
+#define ECC256_WNAF_WINDOW 5
+static int wnaf256(const FE256* k, int w, int digits[257]) {
+    uint64 v[5] = { k->v[0], k->v[1], k->v[2], k->v[3], 0 };
+    uint64 mask = (1ULL << w) - 1;
+    int64 half = 1LL << (w - 1);
+    int len = 0;
+    while (v[0] | v[1] | v[2] | v[3] | v[4]) {
+        int d = 0;
+        if (v[0] & 1) {
+            int64 x = (int64)(v[0] & mask);
+            if (x >= half) x -= (int64)(mask + 1);
+            d = (int)x;
+            uint64 c = 0;
+            if (x > 0) {
+                v[0] = subb(v[0], (uint64)x, &c);
+                for (int i = 1; i < 5; i++) v[i] = subb(v[i], 0, &c);
+            }
+            else {
+                v[0] = addc(v[0], (uint64)(-x), &c);
+                for (int i = 1; i < 5; i++) v[i] = addc(v[i], 0, &c);
+            }
+        }
+        digits[len++] = d;
+        for (int i = 0; i < 4; i++) v[i] = (v[i] >> 1) | (v[i + 1] << 63);
+        v[4] >>= 1;
+    }
+    return len;
+}
+
+// ʱ汾ֻڹ (ǩе u2)
+static void scalar_mult_jacobian(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const FE256* k, const ECC256_Point* P) {
+    ECC256_JacobianPoint acc;
+    set_infinity(curve, &acc);
+    if (P->is_infinity || fe256_is_zero(k)) {
+        *R = acc;
+        return;
+    }
+
+    //  (2i+1)Pſɱ
+    const int table_size = 1 << (ECC256_WNAF_WINDOW - 2);
+    ECC256_JacobianPoint table[1 << (ECC256_WNAF_WINDOW - 2)], P2, neg;
+    ecc256_to_jacobian(curve, &table[0], P);
+    ecc256_jacobian_double(curve, &P2, &table[0]);
+    for (int i = 1; i < table_size; i++) ecc256_jacobian_add(curve, &table[i], &table[i - 1], &P2);
+
+    int digits[257];
+    int len = wnaf256(k, ECC256_WNAF_WINDOW, digits);
+    for (int i = len - 1; i >= 0; i--) {
+        ecc256_jacobian_double(curve, &acc, &acc);
+        int d = digits[i];
+        if (d > 0) {
+            ecc256_jacobian_add(curve, &acc, &acc, &table[d >> 1]);
+        }
+        else if (d < 0) {
+            neg = table[(-d) >> 1];
+            FE256 zero = { { 0, 0, 0, 0 } };
+            field256_sub(&curve->field, &neg.Y, &zero, &neg.Y);
+            ecc256_jacobian_add(curve, &acc, &acc, &neg);
+        }
+    }
+    *R = acc;
+}
+
+// ̶: table[i * 15 + d - 1] = d * 2^(4i) * G (ڱʾķ)
+// ſɱۼӣ Montgomery һȫתΪ
+static bool build_base_table(ECC256_Curve* curve) {
+    const FIELD256* f = &curve->field;
+    const int count = ECC256_BASE_ROWS * ECC256_BASE_COLS;
+    ECC256_Point* table = new (std::nothrow) ECC256_Point[count];
+    if (table == nullptr) return false;
+
+    std::vector<ECC256_JacobianPoint> jt(count);
+    ECC256_JacobianPoint base;
+    ecc256_to_jacobian(curve, &base, &curve->G);
+    for (int i = 0; i < ECC256_BASE_ROWS; i++) {
+        ECC256_JacobianPoint* row = &jt[(size_t)i * ECC256_BASE_COLS];
+        row[0] = base;
+        for (int d = 1; d < ECC256_BASE_COLS; d++) ecc256_jacobian_add(curve, &row[d], &row[d - 1], &base);
+        ecc256_jacobian_add(curve, &base, &row[ECC256_BASE_COLS - 1], &base);
+    }
+
+    std::vector<FE256> prefix(count);
+    FE256 acc = f->one, inv;
+    for (int i = 0; i < count; i++) {
+        prefix[i] = acc;
+        if (!fe256_is_zero(&jt[i].Z)) field256_mul(f, &acc, &acc, &jt[i].Z);
+    }
+    field256_inv(f, &inv, &acc);
+    for (int i = count - 1; i >= 0; i--) {
+        if (fe256_is_zero(&jt[i].Z)) {
+            memset(&table[i], 0, sizeof(ECC256_Point));
+            table[i].is_infinity = true;
+            continue;
+        }
+        FE256 z_inv, z_inv2, z_inv3;
+        field256_mul(f, &z_inv, &inv, &prefix[i]);
+        field256_mul(f, &inv, &inv, &jt[i].Z);
+        field256_sqr(f, &z_inv2, &z_inv);
+        field256_mul(f, &z_inv3, &z_inv2, &z_inv);
+        field256_mul(f, &table[i].x, &jt[i].X, &z_inv2);
+        field256_mul(f, &table[i].y, &jt[i].Y, &z_inv3);
+        table[i].is_infinity = false;
+    }
+    curve->base_table = table;
+    return true;
+}
+
+static inline uint32 base_digit(const FE256* k, int i) {
+    return (uint32)(k->v[i / 16] >> (4 * (i % 16))) & ECC256_BASE_COLS;
+}
+
+// ʱ汾ֻڹ (ǩе u1)
+static void base_mult_jacobian(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const FE256* k) {
+    set_infinity(curve, R);
+    for (int i = 0; i < ECC256_BASE_ROWS; i++) {
+        uint32 d = base_digit(k, i);
+        if (d) jacobian_add_affine(curve, R, R, &curve->base_table[i * ECC256_BASE_COLS + d - 1]);
+    }
+}
+
+// ѡ: bit = 1 ʱ r = a
+static inline void fe256_cmov(FE256* r, const FE256* a, uint64 bit) {
+    uint64 mask = (uint64)0 - bit;
+    for (int i = 0; i < 4; i++) r->v[i] ^= (r->v[i] ^ a->v[i]) & mask;
+}
+
+static inline uint64 fe256_zero_bit(const FE256* a) {
+    uint64 z = a->v[0] | a->v[1] | a->v[2] | a->v[3];
+    return ((z | ((uint64)0 - z)) >> 63) ^ 1;
+}
+
+// ʱѡȡ row[d - 1]: ɨУd = 0 ʱõ (0, 0)ɵ߰붪
+static void select_base(ECC256_Point* r, const ECC256_Point* row, uint32 d) {
+    memset(r, 0, sizeof(ECC256_Point));
+    for (uint32 j = 1; j <= ECC256_BASE_COLS; j++) {
+        uint64 eq = ((uint64)(d ^ j) - 1) >> 63;
+        fe256_cmov(&r->x, &row[j - 1].x, eq);
+        fe256_cmov(&r->y, &row[j - 1].y, eq);
+        r->is_infinity |= (bool)(eq & row[j - 1].is_infinity);
+    }
+}
+
+// ʱ汾ܱ (˽Կǩ k):
+// ÿжɨбһεӣ"R ΪԶ"  "Ϊ 0" ѡ
+//  k < n ߣǰ i еĲֺ (k mod 16^i) G  d 16^i Gʽ֣
+// һ (Ǳ׼߻ k >= n)˻رʱ汾֤ȷ
+static void base_mult_jacobian_ct(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const FE256* k) {
+    const FIELD256* f = &curve->field;
+    ECC256_Point Q;
+    ECC256_JacobianPoint T;
+    FE256 H, r;
+    uint64 r_inf = 1, bad = 0;
+    set_infinity(curve, R);
+    for (int i = 0; i < ECC256_BASE_ROWS; i++) {
+        uint32 d = base_digit(k, i);
+        uint64 d_zero = ((uint64)d - 1) >> 63;
+        select_base(&Q, &curve->base_table[i * ECC256_BASE_COLS], d);
+        add_affine_formula(curve, &T, &H, &r, R, &Q);
+        bad |= ((fe256_zero_bit(&H) & (r_inf ^ 1)) | (uint64)Q.is_infinity) & (d_zero ^ 1);
+
+        fe256_cmov(&T.X, &Q.x, r_inf);
+        fe256_cmov(&T.Y, &Q.y, r_inf);
+        fe256_cmov(&T.Z, &f->one, r_inf);
+        fe256_cmov(&R->X, &T.X, d_zero ^ 1);
+        fe256_cmov(&R->Y, &T.Y, d_zero ^ 1);
+        fe256_cmov(&R->Z, &T.Z, d_zero ^ 1);
+        r_inf &= d_zero;
+    }
+    if (bad) base_mult_jacobian(curve, R, k);
+}
+
+// ʱѡȡ table[d - 1]: ɨűd = 0 ʱõȫ 0 ĵ㣬ɵ߰붪
+static void select_jacobian(ECC256_JacobianPoint* r, const ECC256_JacobianPoint* table, uint32 d) {
+    memset(r, 0, sizeof(ECC256_JacobianPoint));
+    for (uint32 j = 1; j <= ECC256_BASE_COLS; j++) {
+        uint64 eq = ((uint64)(d ^ j) - 1) >> 63;
+        fe256_cmov(&r->X, &table[j - 1].X, eq);
+        fe256_cmov(&r->Y, &table[j - 1].Y, eq);
+        fe256_cmov(&r->Z, &table[j - 1].Z, eq);
+    }
+}
+
+// ʱ汾ܱ ( ECDH ˽Կ): ̶ͬ 4 λڣ d P (d = 1..15) ֳ㣻
+// Ӹλÿ 4 α㡢ɨűһεӣ"R ΪԶ"  "Ϊ 0" ѡ
+// k < n  P ĽΪ n ʱۼֵ 16m P  d Pʽ֣
+// һ (k >= n  P Ľ׺С)˻ wNAF ֤ȷ
+static void scalar_mult_jacobian_ct(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const FE256* k,
+                                    const ECC256_Point* P) {
+    if (P->is_infinity) {
+        set_infinity(curve, R);
+        return;
+    }
+    ECC256_JacobianPoint table[ECC256_BASE_COLS], Q, T;
+    uint64 bad = 0;
+    ecc256_to_jacobian(curve, &table[0], P);
+    for (int d = 1; d < ECC256_BASE_COLS; d++) {
+        ecc256_jacobian_add(curve, &table[d], &table[d - 1], &table[0]);
+        bad |= fe256_zero_bit(&table[d].Z);
+    }
+    if (bad) {
+        scalar_mult_jacobian(curve, R, k, P);
+        return;
+    }
+
+    FE256 H, r;
+    uint64 r_inf = 1;
+    set_infinity(curve, R);
+    for (int i = ECC256_BASE_ROWS - 1; i >= 0; i--) {
+        for (int j = 0; j < ECC256_BASE_WINDOW; j++) double_formula(curve, R, R);
+        uint32 d = base_digit(k, i);
+        uint64 d_zero = ((uint64)d - 1) >> 63;
+        select_jacobian(&Q, table, d);
+        add_formula(curve, &T, &H, &r, R, &Q);
+        bad |= fe256_zero_bit(&H) & (r_inf ^ 1) & (d_zero ^ 1);
+
+        fe256_cmov(&T.X, &Q.X, r_inf);
+        fe256_cmov(&T.Y, &Q.Y, r_inf);
+        fe256_cmov(&T.Z, &Q.Z, r_inf);
+        fe256_cmov(&R->X, &T.X, d_zero ^ 1);
+        fe256_cmov(&R->Y, &T.Y, d_zero ^ 1);
+        fe256_cmov(&R->Z, &T.Z, d_zero ^ 1);
+        r_inf &= d_zero;
+    }
+    if (bad) scalar_mult_jacobian(curve, R, k, P);
+}
+
+void ecc256_scalar_mult(const ECC256_Curve* curve, ECC256_Point* R, const FE256* k, const ECC256_Point* P) {
+    ECC256_JacobianPoint J;
+    scalar_mult_jacobian_ct(curve, &J, k, P);
+    ecc256_from_jacobian(curve, R, &J);
+}
+
+void ecc256_scalar_mult_base(const ECC256_Curve* curve, ECC256_Point* R, const FE256* k) {
+    ECC256_JacobianPoint J;
+    base_mult_jacobian_ct(curve, &J, k);
+    ecc256_from_jacobian(curve, R, &J);
+}
+
+bool ecc256_curve_init(ECC256_Curve* curve, const FE256* p, const FE256* a, const FE256* b,
+                       const FE256* n, const FE256* gx, const FE256* gy) {
+    curve->base_table = nullptr;
+    field256_init(&curve->field, p);
+    field256_init(&curve->order, n);
+    field256_to(&curve->field, &curve->a, a);
+    field256_to(&curve->field, &curve->b, b);
+
+    FE256 minus3 = *p;
+    const uint64 three[4] = { 3, 0, 0, 0 };
+    sub4(minus3.v, minus3.v, three);
+    if (fe256_is_zero(a)) curve->a_kind = ECC256_A_ZERO;
+    else if (fe256_cmp(a, &minus3) == 0) curve->a_kind = ECC256_A_MINUS3;
+    else curve->a_kind = ECC256_A_GENERIC;
+
+    curve->G.x = *gx;
+    curve->G.y = *gy;
+    curve->G.is_infinity = false;
+    if (!ecc256_is_on_curve(curve, &curve->G)) {
+        printf("Error: Generator point is not on the curve.\n");
+        return false;
+    }
+    return build_base_table(curve);
+}
+
+void ecc256_curve_free(ECC256_Curve* curve) {
+    delete[] curve->base_table;
+    curve->base_table = nullptr;
+}
+
+static void init_named_curve(ECC256_Curve* curve, const char* p, const char* a, const char* b,
+                             const char* n, const char* gx, const char* gy) {
+    FE256 fp, fa, fb, fn, fx, fy;
+    fe256_from_hex(&fp, p);
+    fe256_from_hex(&fa, a);
+    fe256_from_hex(&fb, b);
+    fe256_from_hex(&fn, n);
+    fe256_from_hex(&fx, gx);
+    fe256_from_hex(&fy, gy);
+    ecc256_curve_init(curve, &fp, &fa, &fb, &fn, &fx, &fy);
+}
+
+const ECC256_Curve* ecc256_curve_p256(void) {
+    static ECC256_Curve curve;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        init_named_curve(&curve,
+            "ffffffff00000001000000000000000000000000ffffffffffffffffffffffff",
+            "ffffffff00000001000000000000000000000000fffffffffffffffffffffffc",
+            "5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b",
+            "ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551",
+            "6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296",
+            "4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5");
+    });
+    return &curve;
+}
+
+const ECC256_Curve* ecc256_curve_secp256k1(void) {
+    static ECC256_Curve curve;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        init_named_curve(&curve,
+            "fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f",
+            "0",
+            "7",
+            "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141",
+            "79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798",
+            "483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8");
+    });
+    return &curve;
+}
+
+// --- 4. ECDSA ---
+
+// ժҪ ->  mod n (n Ϊ 256 λժҪֱӰ˽ͺһ n)
+static void hash_to_scalar(const ECC256_Curve* curve, FE256* e, const uint8 hash[32]) {
+    fe256_from_bytes(e, hash);
+    if (fe256_cmp(e, &curve->order.p) >= 0) sub4(e->v, e->v, curve->order.p.v);
+}
+
+// 1 <= k < n
+static bool scalar_in_range(const ECC256_Curve* curve, const FE256* k) {
+    return !fe256_is_zero(k) && fe256_cmp(k, &curve->order.p) < 0;
+}
+
+// x  (< p) Լ mod n
+static void x_mod_n(const ECC256_Curve* curve, FE256* r, const FE256* x) {
+    *r = *x;
+    while (fe256_cmp(r, &curve->order.p) >= 0) sub4(r->v, r->v, curve->order.p.v);
+}
+
+bool ecc256_generate_public(const ECC256_Curve* curve, const FE256* d, ECC256_Point* Q) {
+    if (!scalar_in_range(curve, d)) return false;
+    ecc256_scalar_mult_base(curve, Q, d);
+    return true;
+}
+
+// s = k^(-1) (e + r d) mod n Montgomery ʽ GF(n) 
+bool ecdsa256_sign(const ECC256_Curve* curve, const uint8 hash[32], const FE256* k, const FE256* d,
+                   ECC256_Signature* sig) {
+    const FIELD256* fn = &curve->order;
+    if (!scalar_in_range(curve, k) || !scalar_in_range(curve, d)) return false;
+
+    ECC256_Point R;
+    ecc256_scalar_mult_base(curve, &R, k);
+    x_mod_n(curve, &sig->r, &R.x);
+    if (fe256_is_zero(&sig->r)) return false;
+
+    FE256 e, mk, mk_inv, me, mr, md, t;
+    hash_to_scalar(curve, &e, hash);
+    field256_to(fn, &mk, k);
+    field256_to(fn, &me, &e);
+    field256_to(fn, &mr, &sig->r);
+    field256_to(fn, &md, d);
+    field256_inv(fn, &mk_inv, &mk);
+    field256_mul(fn, &t, &mr, &md);
+    field256_add(fn, &t, &t, &me);
+    field256_mul(fn, &t, &t, &mk_inv);
+    field256_from(fn, &sig->s, &t);
+    return !fe256_is_zero(&sig->s);
+}
+
+// u1 = e / s, u2 = r / s, R = u1 G + u2 Q R.x mod n == r
+bool ecdsa256_verify(const ECC256_Curve* curve, const uint8 hash[32], const ECC256_Signature* sig,
+                     const ECC256_Point* Q) {
+    const FIELD256* fn = &curve->order;
+    if (!scalar_in_range(curve, &sig->r) || !scalar_in_range(curve, &sig->s)) return false;
+    if (Q->is_infinity || !ecc256_is_on_curve(curve, Q)) return false;
+
+    FE256 e, ms, w, t, u1, u2;
+    hash_to_scalar(curve, &e, hash);
+    field256_to(fn, &ms, &sig->s);
+    field256_inv(fn, &w, &ms);
+    field256_to(fn, &t, &e);
+    field256_mul(fn, &t, &t, &w);
+    field256_from(fn, &u1, &t);
+    field256_to(fn, &t, &sig->r);
+    field256_mul(fn, &t, &t, &w);
+    field256_from(fn, &u2, &t);
+
+    // u1 G ̶u2 Q  wNAFſɱӺֻһ
+    ECC256_JacobianPoint J1, J2, JR;
+    base_mult_jacobian(curve, &J1, &u1);
+    scalar_mult_jacobian(curve, &J2, &u2, Q);
+    ecc256_jacobian_add(curve, &JR, &J1, &J2);
+
+    ECC256_Point R;
+    ecc256_from_jacobian(curve, &R, &JR);
+    if (R.is_infinity) return false;
+    FE256 x;
+    x_mod_n(curve, &x, &R.x);
+    return fe256_cmp(&x, &sig->r) == 0;
+}
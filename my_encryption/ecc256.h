@@ -0,0 +1,146 @@
+#ifndef ECC256_H
+#define ECC256_H
+
+#include "utils.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// 256 λ / Ԫ: 4  64 λ limbλǰ (v[0] Ϊ 64 λ)
+typedef struct {
+    uint64 v[4];
+} FE256;
+
+// Լʽ
+#define FIELD256_GENERIC 0      // ͨ Montgomery Լ ()
+#define FIELD256_P256 1         // NIST P-256: p = 2^256 - 2^224 + 2^192 + 2^96 - 1 ( p ״ר Montgomery Լ)
+#define FIELD256_SECP256K1 2    // secp256k1: p = 2^256 - 2^32 - 977 ( 2^256 = 2^32 + 977 ۵)
+
+//  GF(p) 
+// secp256k1 ԪؾͨP-256 ͨԪΪ Montgomery ʽ aR mod p (R = 2^256)
+typedef struct {
+    FE256 p;
+    int kind;       // FIELD256_*
+    uint64 n0;      // -p^(-1) mod 2^64 (Montgomery Լ)
+    FE256 r2;       // R^2 mod p
+    FE256 one;      // ڱʾ 1
+} FIELD256;
+
+// ߲ a ʽ (㹫ʽ)
+#define ECC256_A_GENERIC 0
+#define ECC256_A_ZERO 1         // a = 0 (secp256k1)
+#define ECC256_A_MINUS3 2       // a = -3 (P-256)
+
+// 㣬Ϊͨ
+typedef struct {
+    FE256 x;
+    FE256 y;
+    bool is_infinity;
+} ECC256_Point;
+
+// ſɱ (X/Z^2, Y/Z^3)ΪڱʾZ = 0 ΪԶ
+typedef struct {
+    FE256 X;
+    FE256 Y;
+    FE256 Z;
+} ECC256_JacobianPoint;
+
+// ̶: 4 λڣ64  x 15  (ڱʾ)k*G Լ 64 λϵӡޱ
+#define ECC256_BASE_WINDOW 4
+#define ECC256_BASE_ROWS (256 / ECC256_BASE_WINDOW)
+#define ECC256_BASE_COLS ((1 << ECC256_BASE_WINDOW) - 1)
+
+// 256 λ y^2 = x^3 + ax + b (mod p)
+typedef struct {
+    FIELD256 field;             //  GF(p)
+    FIELD256 order;             //  GF(n) ECDSA
+    FE256 a;                    // ڱʾ
+    FE256 b;                    // ڱʾ
+    int a_kind;                 // ECC256_A_*
+    ECC256_Point G;             //  (ͨ)
+    ECC256_Point* base_table;   // ̶
+} ECC256_Curve;
+
+// ECDSA ǩ (ͨ)
+typedef struct {
+    FE256 r;
+    FE256 s;
+} ECC256_Signature;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // --- 1. 256 λ ---
+    // ֽڴ <-> 
+    void fe256_from_bytes(FE256* r, const uint8 in[32]);
+    void fe256_to_bytes(uint8 out[32], const FE256* a);
+    // ʮַ ( 64 λʮ) -> ʽ󷵻 false
+    bool fe256_from_hex(FE256* r, const char* hex);
+    // Ƚ:  -1 / 0 / 1
+    int fe256_cmp(const FE256* a, const FE256* b);
+    bool fe256_is_zero(const FE256* a);
+
+    // --- 2.  ---
+    /**
+     * ʼ GF(p)p Ϊ (p > 2^192)
+     * P-256  secp256k1 ԶѡרԼʹ Montgomery Լ
+     */
+    void field256_init(FIELD256* f, const FE256* p);
+    // ͨ (< p) -> ڱʾڱʾ -> ͨ
+    void field256_to(const FIELD256* f, FE256* r, const FE256* a);
+    void field256_from(const FIELD256* f, FE256* r, const FE256* a);
+    // ڱʾµļӡˡƽ (Fermat: a^(p-2))r ͬ
+    void field256_add(const FIELD256* f, FE256* r, const FE256* a, const FE256* b);
+    void field256_sub(const FIELD256* f, FE256* r, const FE256* a, const FE256* b);
+    void field256_mul(const FIELD256* f, FE256* r, const FE256* a, const FE256* b);
+    void field256_sqr(const FIELD256* f, FE256* r, const FE256* a);
+    void field256_inv(const FIELD256* f, FE256* r, const FE256* a);
+
+    // --- 3.  ---
+    //  (״εʱʼ̶̰߳ȫ)
+    const ECC256_Curve* ecc256_curve_p256(void);
+    const ECC256_Curve* ecc256_curve_secp256k1(void);
+
+    /**
+     * Զ: Ϊͨn Ϊ
+     * @return: G ʱ false
+     */
+    bool ecc256_curve_init(ECC256_Curve* curve, const FE256* p, const FE256* a, const FE256* b,
+                           const FE256* n, const FE256* gx, const FE256* gy);
+    // ͷԶߵĹ̶ (Ҫߵ)
+    void ecc256_curve_free(ECC256_Curve* curve);
+
+    bool ecc256_is_on_curve(const ECC256_Curve* curve, const ECC256_Point* P);
+
+    // ſɱ
+    void ecc256_to_jacobian(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const ECC256_Point* P);
+    void ecc256_from_jacobian(const ECC256_Curve* curve, ECC256_Point* R, const ECC256_JacobianPoint* P);
+    void ecc256_jacobian_double(const ECC256_Curve* curve, ECC256_JacobianPoint* R, const ECC256_JacobianPoint* P);
+    void ecc256_jacobian_add(const ECC256_Curve* curve, ECC256_JacobianPoint* R,
+                             const ECC256_JacobianPoint* P, const ECC256_JacobianPoint* Q);
+
+    // ӷ R = P + Q
+    void ecc256_point_add(const ECC256_Curve* curve, ECC256_Point* R, const ECC256_Point* P, const ECC256_Point* Q);
+    // ˷ R = k * P (4 λ̶ڣʱӣk  ECDH ˽Կֵ
+    // k >= n  P Ľ׺Сʱ˻رʱ wNAF)
+    void ecc256_scalar_mult(const ECC256_Curve* curve, ECC256_Point* R, const FE256* k, const ECC256_Point* P);
+    // ˷ R = k * G (̶ʱӣk ˽Կǩ)
+    void ecc256_scalar_mult_base(const ECC256_Curve* curve, ECC256_Point* R, const FE256* k);
+
+    // --- 4. ECDSA ---
+    // Կ Q = d * Gd  1 <= d < n
+    bool ecc256_generate_public(const ECC256_Curve* curve, const FE256* d, ECC256_Point* Q);
+    /**
+     * ǩ: hash Ϊ 32 ֽժҪ ()k Ϊʱ (1 <= k < n)
+     * @return: k Ϸ r / s Ϊ 0 ʱ false
+     */
+    bool ecdsa256_sign(const ECC256_Curve* curve, const uint8 hash[32], const FE256* k, const FE256* d,
+                       ECC256_Signature* sig);
+    bool ecdsa256_verify(const ECC256_Curve* curve, const uint8 hash[32], const ECC256_Signature* sig,
+                         const ECC256_Point* Q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ECC256_H
\ No newline at end of file
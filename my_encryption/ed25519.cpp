@@ -0,0 +1,673 @@
+#include "ed25519.h"
+#include "ecc256.h"
+#include "hash.h"
+#include <string.h>
+#include <mutex>
+#include <vector>
+
+// ---  (5 x 51 λ limb) ---
+
+// d = -121665 / 121666
+static const FE25519 ED_D = { { 0x34dca135978a3ULL, 0x1a8283b156ebdULL, 0x5e7a26001c029ULL, 0x739c663a03cbbULL, 0x52036cee2b6ffULL } };
+static const FE25519 ED_D2 = { { 0x69b9426b2f159ULL, 0x35050762add7aULL, 0x3cf44c0038052ULL, 0x6738cc7407977ULL, 0x2406d9dc56dffULL } };
+// sqrt(-1) = 2^((p-1)/4)
+static const FE25519 ED_SQRTM1 = { { 0x61b274a0ea0b0ULL, 0x0d5a5fc8f189dULL, 0x7ef5e9cbd0c60ULL, 0x78595a6804c9eULL, 0x2b8324804fc1dULL } };
+//  B = (x, 4/5)x Ϊż
+static const FE25519 ED_BX = { { 0x62d608f25d51aULL, 0x412a4b4f6592aULL, 0x75b7171a4b31dULL, 0x1ff60527118feULL, 0x216936d3cd6e5ULL } };
+static const FE25519 ED_BY = { { 0x6666666666658ULL, 0x4ccccccccccccULL, 0x1999999999999ULL, 0x3333333333333ULL, 0x6666666666666ULL } };
+static const FE25519 ED_BT = { { 0x68ab3a5b7dda3ULL, 0x00eea2a5eadbbULL, 0x2af8df483c27eULL, 0x332b375274732ULL, 0x67875f0fd78b7ULL } };
+
+// Ľ L = 2^252 + 27742317777372353535851937790883648493 (4 x 64 λ limb)
+static const FE256 ED_L = { { 0x5812631a5cf5d3edULL, 0x14def9dea2f79cd6ULL, 0x0000000000000000ULL, 0x1000000000000000ULL } };
+
+// ̶: ED_BASE_ROWS  x 15  4 λڱ
+#define ED_BASE_ROWS 64
+#define ED_BASE_COLS 15
+// ǩʱһ wNAF Ĵڿ ( 2^(w-2) = 64 )ԿһĴڿ
+#define ED_BASE_WNAF_WINDOW 8
+#define ED_POINT_WNAF_WINDOW 5
+#define ED_WNAF_MAX_DIGITS 257
+
+// Ԥʽ (y+x, y-x, 2dxy)Ӧ Z = 1 ķ㣬ϵ 7 γ˷
+typedef struct {
+    FE25519 ypx, ymx, xy2d;
+} ED_NIELS;
+
+// ʽ (Y+X, Y-X, Z, 2dT)һ 8 γ˷
+typedef struct {
+    FE25519 ypx, ymx, Z, t2d;
+} ED_CACHED;
+
+// --- 1.  ---
+
+static bool fe_equal(const FE25519* a, const FE25519* b) {
+    uint8 ea[32], eb[32];
+    fe25519_to_bytes(ea, a);
+    fe25519_to_bytes(eb, b);
+    return memcmp(ea, eb, 32) == 0;
+}
+
+static bool fe_is_zero(const FE25519* a) {
+    uint8 e[32];
+    fe25519_to_bytes(e, a);
+    uint8 acc = 0;
+    for (int i = 0; i < 32; i++) acc |= e[i];
+    return acc == 0;
+}
+
+static int fe_is_odd(const FE25519* a) {
+    uint8 e[32];
+    fe25519_to_bytes(e, a);
+    return e[0] & 1;
+}
+
+// --- 2.  (a = -1  hwcd չ깫ʽ걸) ---
+
+static void point_identity(ED25519_Point* P) {
+    fe25519_zero(&P->X);
+    fe25519_one(&P->Y);
+    fe25519_one(&P->Z);
+    fe25519_zero(&P->T);
+}
+
+static bool point_is_identity(const ED25519_Point* P) {
+    return fe_is_zero(&P->X) && fe_equal(&P->Y, &P->Z);
+}
+
+// : A = X^2, B = Y^2, C = 2Z^2, H = A + B, E = H - (X+Y)^2, G = A - B, F = C + G
+static void point_double(ED25519_Point* R, const ED25519_Point* P) {
+    FE25519 A, B, C, E, F, G, H;
+    fe25519_sqr(&A, &P->X);
+    fe25519_sqr(&B, &P->Y);
+    fe25519_sqr(&C, &P->Z);
+    fe25519_add(&C, &C, &C);
+    fe25519_add(&H, &A, &B);
+    fe25519_add(&E, &P->X, &P->Y);
+    fe25519_sqr(&E, &E);
+    fe25519_sub(&E, &H, &E);
+    fe25519_sub(&G, &A, &B);
+    fe25519_add(&F, &C, &G);
+    fe25519_mul(&R->X, &E, &F);
+    fe25519_mul(&R->Y, &G, &H);
+    fe25519_mul(&R->T, &E, &H);
+    fe25519_mul(&R->Z, &F, &G);
+}
+
+//  (A, B, C, D) ɵ: E = B - A, F = D -/+ C, G = D +/- C, H = B + A
+static inline void point_finish(ED25519_Point* R, const FE25519* A, const FE25519* B, const FE25519* C,
+                                const FE25519* D, bool neg) {
+    FE25519 E, F, G, H;
+    fe25519_sub(&E, B, A);
+    if (neg) {
+        fe25519_add(&F, D, C);
+        fe25519_sub(&G, D, C);
+    }
+    else {
+        fe25519_sub(&F, D, C);
+        fe25519_add(&G, D, C);
+    }
+    fe25519_add(&H, B, A);
+    fe25519_mul(&R->X, &E, &F);
+    fe25519_mul(&R->Y, &G, &H);
+    fe25519_mul(&R->T, &E, &H);
+    fe25519_mul(&R->Z, &F, &G);
+}
+
+// R = P + Q (neg = true ʱΪ P - Q)Q Ϊʽ
+static void point_add_cached(ED25519_Point* R, const ED25519_Point* P, const ED_CACHED* Q, bool neg) {
+    FE25519 A, B, C, D, t;
+    fe25519_sub(&t, &P->Y, &P->X);
+    fe25519_mul(&A, &t, neg ? &Q->ypx : &Q->ymx);
+    fe25519_add(&t, &P->Y, &P->X);
+    fe25519_mul(&B, &t, neg ? &Q->ymx : &Q->ypx);
+    fe25519_mul(&C, &P->T, &Q->t2d);
+    fe25519_mul(&D, &P->Z, &Q->Z);
+    fe25519_add(&D, &D, &D);
+    point_finish(R, &A, &B, &C, &D, neg);
+}
+
+// R = P + Q (neg = true ʱΪ P - Q)Q ΪԤķʽ
+static void point_add_niels(ED25519_Point* R, const ED25519_Point* P, const ED_NIELS* Q, bool neg) {
+    FE25519 A, B, C, D, t;
+    fe25519_sub(&t, &P->Y, &P->X);
+    fe25519_mul(&A, &t, neg ? &Q->ypx : &Q->ymx);
+    fe25519_add(&t, &P->Y, &P->X);
+    fe25519_mul(&B, &t, neg ? &Q->ymx : &Q->ypx);
+    fe25519_mul(&C, &P->T, &Q->xy2d);
+    fe25519_add(&D, &P->Z, &P->Z);
+    point_finish(R, &A, &B, &C, &D, neg);
+}
+
+static void to_cached(ED_CACHED* r, const ED25519_Point* P) {
+    fe25519_add(&r->ypx, &P->Y, &P->X);
+    fe25519_sub(&r->ymx, &P->Y, &P->X);
+    r->Z = P->Z;
+    fe25519_mul(&r->t2d, &P->T, &ED_D2);
+}
+
+static void point_add(ED25519_Point* R, const ED25519_Point* P, const ED25519_Point* Q) {
+    ED_CACHED c;
+    to_cached(&c, Q);
+    point_add_cached(R, P, &c, false);
+}
+
+// תΪԤʽ:  Z һ (Montgomery )
+static void to_niels_batch(ED_NIELS* out, const ED25519_Point* in, size_t count) {
+    std::vector<FE25519> prefix(count);
+    FE25519 acc, inv, z_inv, x, y;
+    fe25519_one(&acc);
+    for (size_t i = 0; i < count; i++) {
+        prefix[i] = acc;
+        fe25519_mul(&acc, &acc, &in[i].Z);
+    }
+    fe25519_inv(&inv, &acc);
+    for (size_t i = count; i-- > 0;) {
+        fe25519_mul(&z_inv, &inv, &prefix[i]);
+        fe25519_mul(&inv, &inv, &in[i].Z);
+        fe25519_mul(&x, &in[i].X, &z_inv);
+        fe25519_mul(&y, &in[i].Y, &z_inv);
+        fe25519_add(&out[i].ypx, &y, &x);
+        fe25519_sub(&out[i].ymx, &y, &x);
+        fe25519_mul(&out[i].xy2d, &x, &y);
+        fe25519_mul(&out[i].xy2d, &out[i].xy2d, &ED_D2);
+    }
+}
+
+void ed25519_point_encode(uint8 out[32], const ED25519_Point* P) {
+    FE25519 z_inv, x, y;
+    fe25519_inv(&z_inv, &P->Z);
+    fe25519_mul(&x, &P->X, &z_inv);
+    fe25519_mul(&y, &P->Y, &z_inv);
+    fe25519_to_bytes(out, &y);
+    out[31] |= (uint8)(fe_is_odd(&x) << 7);
+}
+
+// x^2 = (y^2 - 1) / (d y^2 + 1)x = u v^3 (u v^7)^((p-5)/8)ٰ v x^2 = +-u 
+bool ed25519_point_decode(ED25519_Point* P, const uint8 in[32]) {
+    int sign = in[31] >> 7;
+    FE25519 y, u, v, v3, x, t, one;
+    fe25519_from_bytes(&y, in);
+
+    // y ǹ淶 (< p)
+    uint8 canon[32];
+    fe25519_to_bytes(canon, &y);
+    canon[31] |= (uint8)(sign << 7);
+    if (memcmp(canon, in, 32) != 0) return false;
+
+    fe25519_one(&one);
+    fe25519_sqr(&u, &y);
+    fe25519_mul(&v, &u, &ED_D);
+    fe25519_sub(&u, &u, &one);
+    fe25519_add(&v, &v, &one);
+
+    fe25519_sqr(&v3, &v);
+    fe25519_mul(&v3, &v3, &v);          // v^3
+    fe25519_sqr(&x, &v3);
+    fe25519_mul(&x, &x, &v);            // v^7
+    fe25519_mul(&x, &x, &u);            // u v^7
+    fe25519_pow22523(&x, &x);
+    fe25519_mul(&x, &x, &v3);
+    fe25519_mul(&x, &x, &u);            // u v^3 (u v^7)^((p-5)/8)
+
+    fe25519_sqr(&t, &x);
+    fe25519_mul(&t, &t, &v);            // v x^2
+    if (!fe_equal(&t, &u)) {
+        FE25519 neg_u;
+        fe25519_neg(&neg_u, &u);
+        if (!fe_equal(&t, &neg_u)) return false;
+        fe25519_mul(&x, &x, &ED_SQRTM1);
+    }
+    if (fe_is_zero(&x) && sign) return false;
+    if (fe_is_odd(&x) != sign) fe25519_neg(&x, &x);
+
+    P->X = x;
+    P->Y = y;
+    fe25519_one(&P->Z);
+    fe25519_mul(&P->T, &x, &y);
+    return true;
+}
+
+// --- 3. ̶ mod L ---
+
+typedef struct {
+    ED_NIELS base[ED_BASE_ROWS][ED_BASE_COLS];          // base[i][j] = (j+1) * 16^i * B
+    ED_NIELS odd[1 << (ED_BASE_WNAF_WINDOW - 2)];       // odd[j] = (2j+1) * B
+    FIELD256 order;                                     // GF(L) (Montgomery)
+} ED25519_TABLES;
+
+static const ED25519_TABLES* ed25519_tables() {
+    static ED25519_TABLES tables;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        ED25519_Point B;
+        B.X = ED_BX;
+        B.Y = ED_BY;
+        fe25519_one(&B.Z);
+        B.T = ED_BT;
+
+        // չۼӣȫһ
+        std::vector<ED25519_Point> pts(ED_BASE_ROWS * ED_BASE_COLS);
+        ED25519_Point row_base = B;
+        for (int i = 0; i < ED_BASE_ROWS; i++) {
+            ED25519_Point* row = &pts[i * ED_BASE_COLS];
+            row[0] = row_base;
+            for (int j = 1; j < ED_BASE_COLS; j++) point_add(&row[j], &row[j - 1], &row_base);
+            point_add(&row_base, &row[ED_BASE_COLS - 1], &row_base);
+        }
+        to_niels_batch(&tables.base[0][0], pts.data(), pts.size());
+
+        const int odd_count = 1 << (ED_BASE_WNAF_WINDOW - 2);
+        std::vector<ED25519_Point> odd(odd_count);
+        ED25519_Point B2;
+        point_double(&B2, &B);
+        odd[0] = B;
+        for (int j = 1; j < odd_count; j++) point_add(&odd[j], &odd[j - 1], &B2);
+        to_niels_batch(tables.odd, odd.data(), odd.size());
+
+        field256_init(&tables.order, &ED_L);
+    });
+    return &tables;
+}
+
+// ʱѡȡ base[row][d - 1]d = 0 ʱΪλԪ (1, 1, 0)
+static void select_base(ED_NIELS* r, const ED_NIELS* row, uint8 d) {
+    fe25519_one(&r->ypx);
+    fe25519_one(&r->ymx);
+    fe25519_zero(&r->xy2d);
+    for (int j = 1; j <= ED_BASE_COLS; j++) {
+        uint64 eq = ((uint64)(d ^ j) - 1) >> 63;
+        fe25519_cmov(&r->ypx, &row[j - 1].ypx, eq);
+        fe25519_cmov(&r->ymx, &row[j - 1].ymx, eq);
+        fe25519_cmov(&r->xy2d, &row[j - 1].xy2d, eq);
+    }
+}
+
+void ed25519_scalar_mult_base(ED25519_Point* R, const uint8 k[32]) {
+    const ED25519_TABLES* tables = ed25519_tables();
+    ED_NIELS t;
+    point_identity(R);
+    for (int i = 0; i < ED_BASE_ROWS; i++) {
+        uint8 d = (i & 1) ? (k[i >> 1] >> 4) : (k[i >> 1] & 15);
+        select_base(&t, tables->base[i], d);
+        point_add_niels(R, R, &t, false);
+    }
+}
+
+static void sc_from_bytes(FE256* r, const uint8 in[32]) {
+    for (int i = 0; i < 4; i++) {
+        uint64 w = 0;
+        for (int j = 7; j >= 0; j--) w = (w << 8) | in[8 * i + j];
+        r->v[i] = w;
+    }
+}
+
+static void sc_to_bytes(uint8 out[32], const FE256* a) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 8; j++) out[8 * i + j] = (uint8)(a->v[i] >> (8 * j));
+    }
+}
+
+// 64 ֽС mod LΪ Montgomery ʽ: lo * R + hi * R^2 (R = 2^256)
+static void sc_reduce_mont(const FIELD256* f, FE256* r, const uint8 h[64]) {
+    FE256 lo, hi;
+    sc_from_bytes(&lo, h);
+    sc_from_bytes(&hi, h + 32);
+    field256_to(f, &lo, &lo);
+    field256_to(f, &hi, &hi);
+    field256_to(f, &hi, &hi);
+    field256_add(f, r, &lo, &hi);
+}
+
+// SHA-512(a || b || msg) mod LMontgomery ʽ
+static void hash_to_scalar(const FIELD256* f, FE256* r, const uint8* a, size_t a_len, const uint8* b, size_t b_len,
+                           const uint8* msg, size_t msg_len) {
+    SHA512_CTX ctx;
+    uint8 h[SHA512_BLOCK_SIZE];
+    sha512_init(&ctx);
+    sha512_update(&ctx, a, a_len);
+    if (b_len) sha512_update(&ctx, b, b_len);
+    sha512_update(&ctx, msg, msg_len);
+    sha512_final(&ctx, h);
+    sc_reduce_mont(f, r, h);
+}
+
+// --- 4. ǩ ---
+
+// SHA-512(seed) ǰüΪ aΪǩǰ׺
+static void expand_seed(uint8 a[32], uint8 prefix[32], const uint8 seed[ED25519_SEED_SIZE]) {
+    SHA512_CTX ctx;
+    uint8 h[SHA512_BLOCK_SIZE];
+    sha512_init(&ctx);
+    sha512_update(&ctx, seed, ED25519_SEED_SIZE);
+    sha512_final(&ctx, h);
+    memcpy(a, h, 32);
+    memcpy(prefix, h + 32, 32);
+    a[0] &= 248;
+    a[31] &= 127;
+    a[31] |= 64;
+    memset(h, 0, sizeof(h));
+}
+
+void ed25519_keypair_from_seed(ED25519_KeyPair* kp, const uint8 seed[ED25519_SEED_SIZE]) {
+    expand_seed(kp->a, kp->prefix, seed);
+    ED25519_Point A;
+    ed25519_scalar_mult_base(&A, kp->a);
+    ed25519_point_encode(kp->pub, &A);
+}
+
+void ed25519_public_key(uint8 pub[ED25519_PUBLIC_KEY_SIZE], const uint8 seed[ED25519_SEED_SIZE]) {
+    ED25519_KeyPair kp;
+    ed25519_keypair_from_seed(&kp, seed);
+    memcpy(pub, kp.pub, ED25519_PUBLIC_KEY_SIZE);
+    memset(&kp, 0, sizeof(kp));
+}
+
+void ed25519_sign(uint8 sig[ED25519_SIGNATURE_SIZE], const uint8* msg, size_t msg_len,
+                  const ED25519_KeyPair* kp) {
+    const FIELD256* f = &ed25519_tables()->order;
+    uint8 r_bytes[32];
+
+    // r = SHA-512(prefix || M) mod LR = r * B
+    FE256 r, k, s, am;
+    hash_to_scalar(f, &r, kp->prefix, 32, NULL, 0, msg, msg_len);
+    field256_from(f, &s, &r);
+    sc_to_bytes(r_bytes, &s);
+    ED25519_Point R;
+    ed25519_scalar_mult_base(&R, r_bytes);
+    ed25519_point_encode(sig, &R);
+
+    // S = r + SHA-512(R || A || M) * a mod L
+    hash_to_scalar(f, &k, sig, 32, kp->pub, ED25519_PUBLIC_KEY_SIZE, msg, msg_len);
+    sc_from_bytes(&am, kp->a);
+    field256_to(f, &am, &am);
+    field256_mul(f, &s, &k, &am);
+    field256_add(f, &s, &s, &r);
+    field256_from(f, &s, &s);
+    sc_to_bytes(sig + 32, &s);
+
+    memset(r_bytes, 0, sizeof(r_bytes));
+    memset(&r, 0, sizeof(r));
+    memset(&am, 0, sizeof(am));
+}
+
+//  w  wNAF ( < 2^255)ָ
+static int wnaf_scalar(int8_t* digits, const uint8 s[32], int w) {
+    uint64 k[5] = { 0, 0, 0, 0, 0 };
+    FE256 t;
+    sc_from_bytes(&t, s);
+    for (int i = 0; i < 4; i++) k[i] = t.v[i];
+
+    const int64 full = (int64)1 << w, half = full >> 1;
+    int n = 0;
+    while ((k[0] | k[1] | k[2] | k[3] | k[4]) != 0) {
+        int d = 0;
+        if (k[0] & 1) {
+            int64 m = (int64)(k[0] & (uint64)(full - 1));
+            if (m >= half) m -= full;
+            d = (int)m;
+            // k -= d (d Ϊʱ |d|ܽλ)
+            if (d > 0) {
+                uint64 old = k[0];
+                k[0] -= (uint64)d;
+                for (int i = 1; i < 5 && k[i - 1] > old; i++) { old = k[i]; k[i]--; }
+            }
+            else {
+                uint64 old = k[0];
+                k[0] += (uint64)(-d);
+                for (int i = 1; i < 5 && k[i - 1] < old; i++) { old = k[i]; k[i]++; }
+            }
+        }
+        digits[n++] = (int8_t)d;
+        for (int i = 0; i < 4; i++) k[i] = (k[i] >> 1) | (k[i + 1] << 63);
+        k[4] >>= 1;
+    }
+    return n;
+}
+
+//  s (32 ֽС) ǷС L
+static bool sc_is_canonical(const uint8 s[32]) {
+    FE256 t;
+    sc_from_bytes(&t, s);
+    return fe256_cmp(&t, &ED_L) < 0;
+}
+
+// [8]P = O ?
+static bool is_small_order_zero(const ED25519_Point* P) {
+    ED25519_Point Q;
+    point_double(&Q, P);
+    point_double(&Q, &Q);
+    point_double(&Q, &Q);
+    return point_is_identity(&Q);
+}
+
+bool ed25519_verify(const uint8 sig[ED25519_SIGNATURE_SIZE], const uint8* msg, size_t msg_len,
+                    const uint8 pub[ED25519_PUBLIC_KEY_SIZE]) {
+    const ED25519_TABLES* tables = ed25519_tables();
+    ED25519_Point A, R;
+    if (!ed25519_point_decode(&A, pub) || !ed25519_point_decode(&R, sig) || !sc_is_canonical(sig + 32)) return false;
+
+    FE256 k;
+    uint8 k_bytes[32];
+    hash_to_scalar(&tables->order, &k, sig, 32, pub, ED25519_PUBLIC_KEY_SIZE, msg, msg_len);
+    field256_from(&tables->order, &k, &k);
+    sc_to_bytes(k_bytes, &k);
+
+    // -A : (2j+1) * (-A)
+    const int a_count = 1 << (ED_POINT_WNAF_WINDOW - 2);
+    ED_CACHED a_odd[1 << (ED_POINT_WNAF_WINDOW - 2)];
+    ED25519_Point negA = A, A2, cur;
+    fe25519_neg(&negA.X, &A.X);
+    fe25519_neg(&negA.T, &A.T);
+    point_double(&A2, &negA);
+    cur = negA;
+    to_cached(&a_odd[0], &cur);
+    for (int j = 1; j < a_count; j++) {
+        point_add(&cur, &cur, &A2);
+        to_cached(&a_odd[j], &cur);
+    }
+
+    // Q = [S]B + [k](-A)һ
+    int8_t ds[ED_WNAF_MAX_DIGITS], dk[ED_WNAF_MAX_DIGITS];
+    memset(ds, 0, sizeof(ds));
+    memset(dk, 0, sizeof(dk));
+    int ns = wnaf_scalar(ds, sig + 32, ED_BASE_WNAF_WINDOW);
+    int nk = wnaf_scalar(dk, k_bytes, ED_POINT_WNAF_WINDOW);
+    ED25519_Point Q;
+    point_identity(&Q);
+    for (int i = (ns > nk ? ns : nk) - 1; i >= 0; i--) {
+        point_double(&Q, &Q);
+        if (ds[i] > 0) point_add_niels(&Q, &Q, &tables->odd[ds[i] >> 1], false);
+        else if (ds[i] < 0) point_add_niels(&Q, &Q, &tables->odd[(-ds[i]) >> 1], true);
+        if (dk[i] > 0) point_add_cached(&Q, &Q, &a_odd[dk[i] >> 1], false);
+        else if (dk[i] < 0) point_add_cached(&Q, &Q, &a_odd[(-dk[i]) >> 1], true);
+    }
+
+    // [8](Q - R) = O
+    ED_CACHED rc;
+    to_cached(&rc, &R);
+    point_add_cached(&Q, &Q, &rc, true);
+    return is_small_order_zero(&Q);
+}
+
+// --- 5. ǩ ---
+
+// Pippenger: sum scalars[i] * points[i]Ϊ 4 x 64 λ limb (С) bits λ
+static void ed25519_msm(ED25519_Point* R, const FE256* scalars, const ED_CACHED* points, size_t count, int bits) {
+    // ڿ: С (bits / c) * (count + 2^(c+1)) ε
+    int c = 1;
+    double best = 0;
+    for (int t = 1; t <= 16; t++) {
+        double cost = (double)((bits + t - 1) / t) * ((double)count + (double)(2 << t));
+        if (t == 1 || cost < best) { best = cost; c = t; }
+    }
+    int windows = (bits + c - 1) / c;
+    size_t nb = ((size_t)1 << c) - 1;
+    std::vector<ED25519_Point> buckets(nb);
+    std::vector<bool> used(nb);
+
+    point_identity(R);
+    for (int j = windows - 1; j >= 0; j--) {
+        if (j != windows - 1) {
+            for (int t = 0; t < c; t++) point_double(R, R);
+        }
+        for (size_t b = 0; b < nb; b++) used[b] = false;
+
+        int shift = j * c;
+        for (size_t i = 0; i < count; i++) {
+            const uint64* v = scalars[i].v;
+            uint64 d = v[shift >> 6] >> (shift & 63);
+            if ((shift & 63) + c > 64 && (shift >> 6) < 3) d |= v[(shift >> 6) + 1] << (64 - (shift & 63));
+            d &= nb;
+            if (d == 0) continue;
+            if (!used[d - 1]) {
+                // Ͱֱɻʽָչ (2X, 2Y, 2Z)ʡȥ뵥λԪĵ
+                ED25519_Point* B = &buckets[d - 1];
+                fe25519_sub(&B->X, &points[i].ypx, &points[i].ymx);
+                fe25519_add(&B->Y, &points[i].ypx, &points[i].ymx);
+                fe25519_add(&B->Z, &points[i].Z, &points[i].Z);
+                fe25519_mul(&B->T, &B->X, &B->Y);
+                fe25519_mul(&B->X, &B->X, &B->Z);
+                fe25519_mul(&B->Y, &B->Y, &B->Z);
+                fe25519_sqr(&B->Z, &B->Z);
+                used[d - 1] = true;
+            }
+            else {
+                point_add_cached(&buckets[d - 1], &buckets[d - 1], &points[i], false);
+            }
+        }
+
+        // sum(d * B_d) = Ӹߵ͵ǰ׺ۼ
+        ED25519_Point run, acc;
+        point_identity(&run);
+        point_identity(&acc);
+        bool any = false;
+        for (size_t b = nb; b-- > 0;) {
+            if (used[b]) {
+                point_add(&run, &run, &buckets[b]);
+                any = true;
+            }
+            if (any) point_add(&acc, &acc, &run);
+        }
+        if (any) point_add(R, R, &acc);
+    }
+}
+
+typedef struct {
+    const uint8* const* msgs;
+    const size_t* msg_lens;
+    const uint8* sigs;
+    const uint8* pubs;
+    bool* ok;
+    size_t count;
+} ED25519_BATCH_JOB;
+
+static void ed25519_batch_chunk(const ED25519_BATCH_JOB* job, size_t begin, size_t end) {
+    const ED25519_TABLES* tables = ed25519_tables();
+    const FIELD256* f = &tables->order;
+    size_t n = end - begin;
+
+    // ϵ z_i: ÿȡ 32 ֽϵͳӣSHA-512(seed || j)  4  128 λϵ
+    uint8 seed[40];
+    for (int i = 0; i < 4; i++) {
+        uint64 r = random_uint64();
+        for (int j = 0; j < 8; j++) seed[8 * i + j] = (uint8)(r >> (8 * j));
+    }
+
+    std::vector<FE256> scalars(2 * n + 1);
+    std::vector<ED_CACHED> points(2 * n + 1);
+    size_t m = 0;
+    FE256 sum_zs = { { 0, 0, 0, 0 } };      // sum z_i S_i (Montgomery ʽ)
+    uint8 zbuf[SHA512_BLOCK_SIZE];
+
+    for (size_t t = 0; t < n; t++) {
+        size_t i = begin + t;
+        const uint8* sig = job->sigs + i * ED25519_SIGNATURE_SIZE;
+        const uint8* pub = job->pubs + i * ED25519_PUBLIC_KEY_SIZE;
+        ED25519_Point A, R;
+        job->ok[i] = ed25519_point_decode(&A, pub) && ed25519_point_decode(&R, sig) && sc_is_canonical(sig + 32);
+        if (!job->ok[i]) continue;
+
+        if ((t & 3) == 0) {
+            uint64 ctr = (uint64)t;
+            for (int j = 0; j < 8; j++) seed[32 + j] = (uint8)(ctr >> (8 * j));
+            SHA512_CTX ctx;
+            sha512_init(&ctx);
+            sha512_update(&ctx, seed, sizeof(seed));
+            sha512_final(&ctx, zbuf);
+        }
+        FE256 z = { { 0, 0, 0, 0 } }, zm, k, s;
+        const uint8* zb = zbuf + 16 * (t & 3);
+        for (int j = 7; j >= 0; j--) { z.v[0] = (z.v[0] << 8) | zb[j]; z.v[1] = (z.v[1] << 8) | zb[8 + j]; }
+        field256_to(f, &zm, &z);
+
+        // R_i ϵ z_iA_i ϵ z_i * k_i mod L
+        hash_to_scalar(f, &k, sig, 32, pub, ED25519_PUBLIC_KEY_SIZE, job->msgs[i], job->msg_lens[i]);
+        field256_mul(f, &k, &k, &zm);
+        field256_from(f, &k, &k);
+        sc_from_bytes(&s, sig + 32);
+        field256_to(f, &s, &s);
+        field256_mul(f, &s, &s, &zm);
+        field256_add(f, &sum_zs, &sum_zs, &s);
+
+        scalars[m] = z;
+        to_cached(&points[m++], &R);
+        scalars[m] = k;
+        to_cached(&points[m++], &A);
+    }
+    if (m == 0) return;
+
+    // B ϵ -(sum z_i S_i) mod L
+    FE256 b = { { 0, 0, 0, 0 } };
+    field256_from(f, &sum_zs, &sum_zs);
+    field256_sub(f, &b, &b, &sum_zs);
+    scalars[m] = b;
+    ED25519_Point B;
+    B.X = ED_BX;
+    B.Y = ED_BY;
+    fe25519_one(&B.Z);
+    B.T = ED_BT;
+    to_cached(&points[m++], &B);
+
+    ED25519_Point Q;
+    ed25519_msm(&Q, scalars.data(), points.data(), m, 253);
+    if (is_small_order_zero(&Q)) return;
+
+    // δͨ: λ
+    for (size_t i = begin; i < end; i++) {
+        if (job->ok[i]) {
+            job->ok[i] = ed25519_verify(job->sigs + i * ED25519_SIGNATURE_SIZE, job->msgs[i], job->msg_lens[i],
+                                        job->pubs + i * ED25519_PUBLIC_KEY_SIZE);
+        }
+    }
+}
+
+static void ed25519_batch_range(size_t begin, size_t end, void* arg) {
+    const ED25519_BATCH_JOB* job = (const ED25519_BATCH_JOB*)arg;
+    for (size_t c = begin; c < end; c++) {
+        size_t lo = c * ED25519_BATCH_CHUNK;
+        size_t hi = lo + ED25519_BATCH_CHUNK < job->count ? lo + ED25519_BATCH_CHUNK : job->count;
+        ed25519_batch_chunk(job, lo, hi);
+    }
+}
+
+size_t ed25519_verify_batch(const uint8* const msgs[], const size_t msg_lens[], const uint8* sigs,
+                            const uint8* pubs, bool* results, size_t count, int num_threads) {
+    if (count == 0) return 0;
+    bool* ok = results ? results : new bool[count];
+    ED25519_BATCH_JOB job;
+    job.msgs = msgs;
+    job.msg_lens = msg_lens;
+    job.sigs = sigs;
+    job.pubs = pubs;
+    job.ok = ok;
+
+    job.count = count;
+
+    size_t chunks = (count + ED25519_BATCH_CHUNK - 1) / ED25519_BATCH_CHUNK;
+    parallel_for(chunks, num_threads, ed25519_batch_range, &job);
+
+    size_t valid = 0;
+    for (size_t i = 0; i < count; i++) valid += ok[i] ? 1 : 0;
+    if (!results) delete[] ok;
+    return valid;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#ifndef ED25519_H
+#define ED25519_H
+
+#include "utils.h"
+#include "curve25519.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Ť Edwards  -x^2 + y^2 = 1 + d x^2 y^2 over GF(2^255 - 19) Curve25519 ˫ȼ
+// ˽ԿΪ 32 ֽӣԿΪѹ (y С˱룬λ x ż)ǩΪ R || S
+#define ED25519_SEED_SIZE 32
+#define ED25519_PUBLIC_KEY_SIZE 32
+#define ED25519_SIGNATURE_SIZE 64
+
+// չ (X : Y : Z : T)x = X/Zy = Y/ZT = XY/Z
+typedef struct {
+    FE25519 X, Y, Z, T;
+} ED25519_Point;
+
+// չǩԿ: ü˽Կ aǩǰ׺빫Կ A = aB
+// ֻͨ ed25519_keypair_from_seed ɣ֤ǩϣе A  a һ
+// (ͬһϢڲͬ A ǩḴ r S ɽ a)
+typedef struct {
+    uint8 a[32];
+    uint8 prefix[32];
+    uint8 pub[ED25519_PUBLIC_KEY_SIZE];
+} ED25519_KeyPair;
+
+// ǩʱÿκϲΪһζ˷ǩ
+#define ED25519_BATCH_CHUNK 128
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // --- 1.  ---
+
+    // ѹ /  (RFC 8032 5.1.2 / 5.1.3)ʱ y >= p  x ڷ false
+    void ed25519_point_encode(uint8 out[32], const ED25519_Point* P);
+    bool ed25519_point_decode(ED25519_Point* P, const uint8 in[32]);
+
+    /**
+     * ˷ R = k * B
+     * ʹ״εʱĹ̶ (64  x 15  4 λڱ㣬Ԥ (y+x, y-x, 2dxy) ʽ)
+     * ÿгʱһλϵӣޱ㣻k Ϊ 32 ֽС
+     */
+    void ed25519_scalar_mult_base(ED25519_Point* R, const uint8 k[32]);
+
+    // --- 2. ǩ (RFC 8032 Ed25519ϣΪ SHA-512) ---
+
+    // ɹԿ
+    void ed25519_public_key(uint8 pub[ED25519_PUBLIC_KEY_SIZE], const uint8 seed[ED25519_SEED_SIZE]);
+
+    // չӲ㹫Կɷǩ (˽ԿϣӦ)
+    void ed25519_keypair_from_seed(ED25519_KeyPair* kp, const uint8 seed[ED25519_SEED_SIZE]);
+
+    // ǩ: ȷԣ r = SHA-512(prefix || M) mod L
+    void ed25519_sign(uint8 sig[ED25519_SIGNATURE_SIZE], const uint8* msg, size_t msg_len,
+                      const ED25519_KeyPair* kp);
+
+    /**
+     * ǩ:  [8][S]B = [8]R + [8][k]Ak = SHA-512(R || A || M) mod L
+     * [S]B - [k]A  wNAF  (B һʹԤ)S >= L ֱӾܾ
+     */
+    bool ed25519_verify(const uint8 sig[ED25519_SIGNATURE_SIZE], const uint8* msg, size_t msg_len,
+                        const uint8 pub[ED25519_PUBLIC_KEY_SIZE]);
+
+    /**
+     * ǩ
+     * ÿ ED25519_BATCH_CHUNK ǩȡ 128 λϵ z_iһ Pippenger ˷
+     * [8]( -(sum z_i S_i) B + sum z_i R_i + sum (z_i k_i) A_i ) = O
+     * ͨȫЧö ed25519_verify λʧηַ̳߳
+     * @param msgs / msg_lens: count Ϣ
+     * @param sigs: count * 64 ֽǩ
+     * @param pubs: count * 32 ֽڹԿ
+     * @param results:  (Ϊ NULL)
+     * @param num_threads: ʹõ߳; <= 0 ʾʹȫ
+     * @return: ֤ͨǩ
+     */
+    size_t ed25519_verify_batch(const uint8* const msgs[], const size_t msg_lens[], const uint8* sigs,
+                                const uint8* pubs, bool* results, size_t count, int num_threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ED25519_H
\ No newline at end of file
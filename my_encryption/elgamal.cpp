@@ -9,8 +9,8 @@ void elgamal_generate_keys(uint64 p, uint64 g, uint64 x, ElGamal_PublicKey* pub,
     priv->x = x;
 
     // 㹫Կ y = g^x mod p
-    // ʹ utils.cpp еĿģ
-    uint64 y = power(g, x, p);
+    // ʹ utils.cpp еĹ̶ģ (ͬʱΪ֮ļ/ǩ g ı)
+    uint64 y = power_fixed_base(g, x, p);
 
     // 乫Կṹ
     pub->p = p;
@@ -32,15 +32,14 @@ ElGamal_Ciphertext elgamal_encrypt(uint64 message, uint64 k, const ElGamal_Publi
     }
 
     //  c1 = g^k mod p
-    ct.c1 = power(pub->g, k, pub->p);
+    ct.c1 = power_fixed_base(pub->g, k, pub->p);
 
     // 㹲 s = y^k mod p
     uint64 s = power(pub->y, k, pub->p);
 
     //  c2 = (message * s) mod p
-    // ע⣺ܻ uint64ڽѧʾСû⡣
-    // ϽдӦʹģ˺򻯴
-    ct.c2 = (message * s) % pub->p;
+    // ʹ mul_modp  32 λʱ˻Ҳ
+    ct.c2 = mul_mod(message, s, pub->p);
 
     return ct;
 }
@@ -61,11 +60,63 @@ uint64 elgamal_decrypt(ElGamal_Ciphertext ciphertext, const ElGamal_PrivateKey*
     }
 
     // 3. ָ M = (c2 * s_inv) mod p
-    uint64 m = (ciphertext.c2 * s_inv) % priv->p;
+    uint64 m = mul_mod(ciphertext.c2, s_inv, priv->p);
 
     return m;
 }
 
+// 3b. 
+typedef struct {
+    MONT_CTX mont;
+    int window;
+    int n_digits;
+    uint8 digits[64];      // ָ p-1-x Ĵڷֽ
+    const ElGamal_Ciphertext* cts;
+    uint64* messages;
+} ELGAMAL_DECRYPT_JOB;
+
+static void elgamal_decrypt_range(size_t begin, size_t end, void* arg) {
+    const ELGAMAL_DECRYPT_JOB* job = (const ELGAMAL_DECRYPT_JOB*)arg;
+    const MONT_CTX* mont = &job->mont;
+    for (size_t i = begin; i < end; i += MONT_INTERLEAVE) {
+        size_t k = (end - i < MONT_INTERLEAVE) ? end - i : MONT_INTERLEAVE;
+        uint64 base[MONT_INTERLEAVE] = { 0 }, s_inv[MONT_INTERLEAVE];
+        for (size_t j = 0; j < k; j++) base[j] = job->cts[i + j].c1;
+        mont_power_x4(mont, job->digits, job->n_digits, job->window, base, s_inv);
+
+        // M = c2 * s^(-1) mod p:  s^(-1) ת Montgomery ʽͨʽ c2 õõͨʽ
+        for (size_t j = 0; j < k; j++) {
+            job->messages[i + j] = (base[j] % mont->n == 0) ? 0
+                : mont_mul(mont_to(s_inv[j], mont), job->cts[i + j].c2 % mont->n, mont);
+        }
+    }
+}
+
+size_t elgamal_decrypt_batch(const ElGamal_Ciphertext* ciphertexts, uint64* messages, size_t count,
+                             const ElGamal_PrivateKey* priv, int num_threads) {
+    uint64 p = priv->p;
+    if (count == 0) return 0;
+    if (p < 3 || (p & 1) == 0) {
+        printf("Error: Batch decryption requires an odd prime modulus.\n");
+        for (size_t i = 0; i < count; i++) messages[i] = 0;
+        return 0;
+    }
+
+    ELGAMAL_DECRYPT_JOB job;
+    mont_init(&job.mont, p);
+    uint64 e = (p - 1) - priv->x % (p - 1); // s^(-1) = c1^(p-1-x)
+    job.window = mont_window_size(e);
+    job.n_digits = mont_split_exponent(e, job.window, job.digits);
+    job.cts = ciphertexts;
+    job.messages = messages;
+    if (count < PARALLEL_MIN_ITEMS) num_threads = 1;
+    parallel_for(count, num_threads, elgamal_decrypt_range, &job);
+
+    size_t ok = 0;
+    for (size_t i = 0; i < count; i++) ok += (ciphertexts[i].c1 % p != 0) ? 1 : 0;
+    return ok;
+}
+
 // 4. ǩ
 // r = g^k mod p
 // s = (M - x*r) * k^(-1) mod (p-1)  <-- עģ p-1
@@ -104,7 +155,7 @@ ElGamal_Signature elgamal_sign(uint64 message, uint64 k, const ElGamal_PrivateKe
     //  g=2 ΪʾڲԴҲʹ g=2
     uint64 g = 2;
 
-    sig.r = power(g, k, p);
+    sig.r = power_fixed_base(g, k, p);
 
     // 2.  s
     // ʽ: M = x*r + k*s (mod p-1)
@@ -142,6 +193,30 @@ ElGamal_Signature elgamal_sign(uint64 message, uint64 k, const ElGamal_PrivateKe
     return sig;
 }
 
+// 4b. ʹԤԪǩ
+// s = (M - x*r) * k^(-1) mod (p-1)
+ElGamal_Signature elgamal_sign_with_nonce(uint64 message, const NONCE_TRIPLE* nonce, const ElGamal_PrivateKey* priv) {
+    ElGamal_Signature sig;
+    sig.r = 0; sig.s = 0;
+    uint64 p_minus_1 = priv->p - 1;
+    if (nonce->r == 0 || nonce->k_inv == 0) {
+        printf("Error: Invalid nonce triple.\n");
+        return sig;
+    }
+
+    sig.r = nonce->r;
+    uint64 xr = mul_mod(priv->x, sig.r, p_minus_1);
+    uint64 m = message % p_minus_1;
+    uint64 diff = (m >= xr) ? m - xr : m + (p_minus_1 - xr);
+    sig.s = mul_mod(diff, nonce->k_inv, p_minus_1);
+    if (sig.s == 0) {
+        // s = 0 ǩᱻУϣ÷ȡµԪǩ
+        printf("Error: s became 0. Need a new nonce.\n");
+        sig.r = 0;
+    }
+    return sig;
+}
+
 // 5. ǩ
 // ֤: y^r * r^s = g^M (mod p)
 bool elgamal_verify(uint64 message, ElGamal_Signature sig, const ElGamal_PublicKey* pub) {
@@ -151,12 +226,13 @@ bool elgamal_verify(uint64 message, ElGamal_Signature sig, const ElGamal_PublicK
     if (sig.r == 0 || sig.r >= p) return false;
 
     // 2.  LHS = (y^r * r^s) mod p
-    uint64 yr = power(pub->y, sig.r, p);
-    uint64 rs = power(sig.r, sig.s, p);
-    uint64 lhs = (yr * rs) % p;
+    // ǩ仯öͬʱģݹһƽ
+    uint64 bases[2] = { pub->y, sig.r };
+    uint64 exps[2] = { sig.r, sig.s };
+    uint64 lhs = multi_power(bases, exps, 2, p);
 
     // 3. ұ RHS = g^M mod p
-    uint64 rhs = power(pub->g, message, p);
+    uint64 rhs = power_fixed_base(pub->g, message, p);
 
     // 4. Ƚ
     return (lhs == rhs);
@@ -62,6 +62,17 @@ extern "C" {
      */
     uint64 elgamal_decrypt(ElGamal_Ciphertext ciphertext, const ElGamal_PrivateKey* priv);
 
+    /**
+     * ElGamal 
+     * ɷС s^(-1) = c1^(p-1-x)ÿֻһģݣҪ;
+     * Ĺͬһ Montgomery ĺָڣ4 㣬ϴʱָ̳߳
+     * @param messages: ģc1 Ч (c1 mod p == 0) д 0
+     * @param num_threads: ʹõ߳; <= 0 ʾʹȫ
+     * @return ɹܵ
+     */
+    size_t elgamal_decrypt_batch(const ElGamal_Ciphertext* ciphertexts, uint64* messages, size_t count,
+                                 const ElGamal_PrivateKey* priv, int num_threads);
+
     // --- 3. ǩ/ǩ ---
     /**
      * ElGamal ǩ
@@ -72,6 +83,15 @@ extern "C" {
      */
     ElGamal_Signature elgamal_sign(uint64 message, uint64 k, const ElGamal_PrivateKey* priv);
 
+    /**
+     * ElGamal ǩ (ʹԤԪ)
+     * Ԫ nonce_pool_create_elgamal(p, g, ...) ĳ: r = g^k mod p, k_inv = k^(-1) mod (p-1)
+     *  elgamal_sign ͬ g ȡԴʱĲǹ̶ g = 2
+     * @param nonce:  nonce_pool_pop ȡԪ飬ÿֻʹһ
+     * @return: s = 0 ʱ (0, 0)÷ȡһԪǩ
+     */
+    ElGamal_Signature elgamal_sign_with_nonce(uint64 message, const NONCE_TRIPLE* nonce, const ElGamal_PrivateKey* priv);
+
     /**
      * ElGamal ǩ
      * @param message: ϢժҪ
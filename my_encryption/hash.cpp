@@ -24,7 +24,7 @@ static const uint32 K[64] = {
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
 // --- ı任: һ 512 λ (64ֽ) Ŀ ---
-static void sha256_transform(SHA256_CTX* ctx, const uint8* data) {
+static void sha256_compress(uint32 state[8], const uint8* data) {
     uint32 a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
     // 1. ׼Ϣȱ W[0..63]
@@ -37,14 +37,14 @@ static void sha256_transform(SHA256_CTX* ctx, const uint8* data) {
         m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
 
     // 2. ʼ
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
-    f = ctx->state[5];
-    g = ctx->state[6];
-    h = ctx->state[7];
+    a = state[0];
+    b = state[1];
+    c = state[2];
+    d = state[3];
+    e = state[4];
+    f = state[5];
+    g = state[6];
+    h = state[7];
 
     // 3. ѭ (64)
     for (i = 0; i < 64; ++i) {
@@ -61,14 +61,18 @@ static void sha256_transform(SHA256_CTX* ctx, const uint8* data) {
     }
 
     // 4. ״̬ (ۼ)
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
-    ctx->state[5] += f;
-    ctx->state[6] += g;
-    ctx->state[7] += h;
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+static void sha256_transform(SHA256_CTX* ctx, const uint8* data) {
+    sha256_compress(ctx->state, data);
 }
 
 // 1. ʼ
@@ -87,129 +91,466 @@ void sha256_init(SHA256_CTX* ctx) {
 }
 
 // 2.  (ַֿ֧)
-//void sha256_update(SHA256_CTX* ctx, const uint8* data, size_t len) {
-//    for (size_t i = 0; i < len; ++i) {
-//        ctx->data[ctx->datalen] = data[i];
-//        ctx->datalen++;
-//
-//        //  (64ֽ)ÿ
-//        if (ctx->datalen == 64) {
-//            sha256_transform(ctx, ctx->data);
-//            ctx->bitlen += 512;
-//            ctx->datalen = 0;
-//        }
-//    }
-//}
-// 滻е sha256_update
+// ֱڵߵĻ任 (㿽)ֻвһͷβž ctx->data
 void sha256_update(SHA256_CTX* ctx, const uint8* data, size_t len) {
-    for (size_t i = 0; i < len; ++i) {
-        ctx->data[ctx->datalen] = data[i];
-        ctx->datalen++;
-
-        if (ctx->datalen == 64) {
-            sha256_transform(ctx, ctx->data);
-            ctx->bitlen += 512;
-            ctx->datalen = 0;
-        }
-    }
-}
-
-// 3.  ( Padding)
-void sha256_final(SHA256_CTX* ctx, uint8 hash[SHA256_BLOCK_SIZE]) {
-    uint32 i = ctx->datalen;
+    size_t i = 0;
 
-    // :
-    // 1. Ȳһ '1' bit (0x80)
-    // 2.  '0' ֱ = 448 mod 512 ( 8 ֽڷų)
-    // 3.  8 ֽڷԭʼݵĳ (Big Endian, bit λ)
+    // a. Ȱϴβİ鲹
+    if (ctx->datalen > 0) {
+        size_t fill = 64 - ctx->datalen;
+        if (fill > len) fill = len;
+        memcpy(ctx->data + ctx->datalen, data, fill);
+        ctx->datalen += (uint32)fill;
+        i = fill;
 
-    //  0x80
-    if (ctx->datalen < 64) {
-        ctx->data[i++] = 0x80;
-    }
-    else {
-        // datalen պˣҪ transform ٲ
+        if (ctx->datalen < 64) return;
         sha256_transform(ctx, ctx->data);
         ctx->bitlen += 512;
         ctx->datalen = 0;
-        ctx->data[0] = 0x80;
-        i = 1;
     }
 
+    // b. ֱӴڲ
+    for (; len - i >= 64; i += 64) {
+        sha256_transform(ctx, data + i);
+        ctx->bitlen += 512;
+    }
+
+    // c. ʣ಻һĲַ뻺
+    memcpy(ctx->data, data + i, len - i);
+    ctx->datalen = (uint32)(len - i);
+}
+
+// :  ctx->data (Ҫʱټ extra) д 1~2 飬ؿ
+// :
+// 1. Ȳһ '1' bit (0x80)
+// 2.  '0' ֱ = 448 mod 512 ( 8 ֽڷų)
+// 3.  8 ֽڷԭʼݵĳ (Big Endian, bit λ)
+static int sha256_pad(SHA256_CTX* ctx, uint8 extra[64]) {
+    uint32 i = ctx->datalen;
+    uint8* last = ctx->data;
+    int blocks = 1;
+
+    // ֮ǰϢܳ:
+    // ѱ任 bits + ʣЧ bits
+    uint64 total_bits = ctx->bitlen + (uint64)ctx->datalen * 8;
+
+    //  0x80 (update ֤ datalen < 64)
+    ctx->data[i++] = 0x80;
+
     // ʣռ䲻 8 ֽ ( i > 56)Ҫ䲢¿һ
     if (i > 56) {
         while (i < 64) ctx->data[i++] = 0x00;
-        sha256_transform(ctx, ctx->data);
-        ctx->bitlen += 512; //  bitlen ʵӰĳֶΣΪǻʵ
-        // û׼ų
-        memset(ctx->data, 0, 56);
-    }
-    else {
-        // ռ㹻 0  56
-        while (i < 56) ctx->data[i++] = 0x00;
-    }
-
-    // ԭʼ (Big Endian)
-    // ע: bitlen Ǵ bits
-    // ҪЧ bits (padding)
-    // ߼΢ update ʱѾۼ bitlen
-    // Ҫ *ʵϢ*  bit ȡ
-    // ȷӦ update ʱۼ bitlen
-    //  update ߼bitlen ÿ 512 żӡ
-    // ܳ = ctx->bitlen + (ctx->datalen * 8) 
-    // ע⣺ datalen ָ final ǰЧݳȡ
-    // ղ޸ datalen  data 飬Եԭʼ datalen 㡣
-    // Ϊ˼򻯣 update ֱۼ bitlen ȫ
-
-    // ---  update  bitlen ߼ƥ final ---
-    // Ϊ˴࣬ݼܳе鷳
-    // ΢һ updateҪ bitlenͳһ㣿
-    // ׼ update ۼơ
-
-    // ¼ܳ (64λ)
-    //  ctx->bitlen Ѿ transform Ŀ bits
-    // Ҫ final ʱֽ * 8
-    // ʱ ctx->datalen Ѿ padding иˡ
-    // ؼ padding ʼǰi ǵʱ datalen
-    // ǣ padding ߼У datalen=64 ⡣
-    // ǲøȽдάһ total_bits 
-    // ߣ final ͷ total_bits
-
-    uint64 total_bits = ctx->bitlen + (uint64)((i - (ctx->data[i - 1] == 0x80 ? 1 : 0)) * 8);
-    // ֻ̫״
-
-    // **򵥵**
-    // Ǽʹߵ update ݡ
-    //  final ĵһУȼ total_bits
-    uint64 final_total_bits = ctx->bitlen + (ctx->datalen * 8);
-
-    // ... (ִ padding ߼ 0x80,  0 ...) ...
-
-    //  8 ֽ final_total_bits (Big Endian)
-    ctx->data[63] = final_total_bits;
-    ctx->data[62] = final_total_bits >> 8;
-    ctx->data[61] = final_total_bits >> 16;
-    ctx->data[60] = final_total_bits >> 24;
-    ctx->data[59] = final_total_bits >> 32;
-    ctx->data[58] = final_total_bits >> 40;
-    ctx->data[57] = final_total_bits >> 48;
-    ctx->data[56] = final_total_bits >> 56;
-
-    // һ
+        last = extra;
+        blocks = 2;
+        i = 0;
+    }
+    while (i < 56) last[i++] = 0x00;
+
+    //  8 ֽڷ total_bits (Big Endian)
+    for (i = 0; i < 8; ++i) {
+        last[63 - i] = (uint8)(total_bits >> (i * 8));
+    }
+    return blocks;
+}
+
+//  (Big Endian)
+static void sha256_output(const uint32 state[8], uint8 hash[SHA256_BLOCK_SIZE]) {
+    for (int i = 0; i < 8; ++i) {
+        hash[i * 4] = (state[i] >> 24) & 0xFF;
+        hash[i * 4 + 1] = (state[i] >> 16) & 0xFF;
+        hash[i * 4 + 2] = (state[i] >> 8) & 0xFF;
+        hash[i * 4 + 3] = (state[i]) & 0xFF;
+    }
+}
+
+// 3.  ( Padding)
+void sha256_final(SHA256_CTX* ctx, uint8 hash[SHA256_BLOCK_SIZE]) {
+    uint8 extra[64];
+    int blocks = sha256_pad(ctx, extra);
+
     sha256_transform(ctx, ctx->data);
+    if (blocks == 2) sha256_transform(ctx, extra);
+
+    sha256_output(ctx->state, hash);
+}
+
+// =======================================================
+// --- · (multi-lane) SHA-256  ---
+// =======================================================
+
+// ͬʱѹ SHA256_LANES Ŀ
+// м [][·] ĽṹŲڲѭ·
+// ԰ֱΪ SSE/AVX/NEON ָһָƽ·
+void sha256_transform_lanes(uint32* const states[], const uint8* const blocks[], int lanes) {
+    static const uint8 zero_block[64] = { 0 };
+    static const uint32 zero_state[8] = { 0 };
+    uint32 m[64][SHA256_LANES];
+    uint32 a[SHA256_LANES], b[SHA256_LANES], c[SHA256_LANES], d[SHA256_LANES];
+    uint32 e[SHA256_LANES], f[SHA256_LANES], g[SHA256_LANES], h[SHA256_LANES];
+    int i, l;
+
+    // ֻһ·ʱû棬ֱ߱ѹ
+    if (lanes == 1) {
+        sha256_compress(states[0], blocks[0]);
+        return;
+    }
+
+    // 1. ׼Ϣȱ (е·ȫ 0 ռλ֤ѭȹ̶)
+    for (l = 0; l < SHA256_LANES; ++l) {
+        const uint8* data = (l < lanes) ? blocks[l] : zero_block;
+        for (i = 0; i < 16; ++i) {
+            m[i][l] = ((uint32)data[i * 4] << 24) | ((uint32)data[i * 4 + 1] << 16) |
+                ((uint32)data[i * 4 + 2] << 8) | ((uint32)data[i * 4 + 3]);
+        }
+    }
+    for (i = 16; i < 64; ++i)
+        for (l = 0; l < SHA256_LANES; ++l)
+            m[i][l] = SIG1(m[i - 2][l]) + m[i - 7][l] + SIG0(m[i - 15][l]) + m[i - 16][l];
+
+    // 2. ʼ
+    for (l = 0; l < SHA256_LANES; ++l) {
+        const uint32* st = (l < lanes) ? states[l] : zero_state;
+        a[l] = st[0]; b[l] = st[1]; c[l] = st[2]; d[l] = st[3];
+        e[l] = st[4]; f[l] = st[5]; g[l] = st[6]; h[l] = st[7];
+    }
+
+    // 3. ѭ (64)ÿͬʱƽ·
+    for (i = 0; i < 64; ++i) {
+        for (l = 0; l < SHA256_LANES; ++l) {
+            uint32 t1 = h[l] + EP1(e[l]) + CH(e[l], f[l], g[l]) + K[i] + m[i][l];
+            uint32 t2 = EP0(a[l]) + MAJ(a[l], b[l], c[l]);
+            h[l] = g[l];
+            g[l] = f[l];
+            f[l] = e[l];
+            e[l] = d[l] + t1;
+            d[l] = c[l];
+            c[l] = b[l];
+            b[l] = a[l];
+            a[l] = t1 + t2;
+        }
+    }
+
+    // 4. ״̬ (ֻдʵʹõ·)
+    for (l = 0; l < lanes; ++l) {
+        uint32* st = states[l];
+        st[0] += a[l]; st[1] += b[l]; st[2] += c[l]; st[3] += d[l];
+        st[4] += e[l]; st[5] += f[l]; st[6] += g[l]; st[7] += h[l];
+    }
+}
+
+// ·: ȼڶÿķֱ sha256_update
+// 鲿ÿ SHA256_LANES ʣһѹ
+void sha256_update_multi(SHA256_CTX* const ctxs[], const uint8* const data[], const size_t lens[], size_t count) {
+    for (size_t base = 0; base < count; base += SHA256_LANES) {
+        size_t n = (count - base < SHA256_LANES) ? count - base : SHA256_LANES;
+        size_t off[SHA256_LANES];
+        bool buffered[SHA256_LANES];  // ctx->data ǷһղѹĿ
+        bool flushed[SHA256_LANES];   // ͷǷѲ (ȫ˻)
+
+        // a. ȰѸ·İ鲹
+        for (size_t j = 0; j < n; ++j) {
+            SHA256_CTX* ctx = ctxs[base + j];
+            off[j] = 0;
+            buffered[j] = false;
+            flushed[j] = true;
+            if (ctx->datalen > 0) {
+                size_t fill = 64 - ctx->datalen;
+                if (fill > lens[base + j]) fill = lens[base + j];
+                memcpy(ctx->data + ctx->datalen, data[base + j], fill);
+                ctx->datalen += (uint32)fill;
+                off[j] = fill;
+                buffered[j] = (ctx->datalen == 64);
+                flushed[j] = buffered[j];
+            }
+        }
+
+        // b. 鰴·ѹֱ·û
+        for (;;) {
+            uint32* states[SHA256_LANES];
+            const uint8* blocks[SHA256_LANES];
+            size_t idx[SHA256_LANES];
+            int lanes = 0;
+
+            for (size_t j = 0; j < n; ++j) {
+                SHA256_CTX* ctx = ctxs[base + j];
+                if (buffered[j]) {
+                    blocks[lanes] = ctx->data;
+                }
+                else if (flushed[j] && lens[base + j] - off[j] >= 64) {
+                    blocks[lanes] = data[base + j] + off[j];
+                }
+                else {
+                    continue;
+                }
+                states[lanes] = ctx->state;
+                idx[lanes++] = j;
+            }
+            if (lanes == 0) break;
+
+            sha256_transform_lanes(states, blocks, lanes);
+
+            for (int k = 0; k < lanes; ++k) {
+                size_t j = idx[k];
+                ctxs[base + j]->bitlen += 512;
+                if (buffered[j]) {
+                    buffered[j] = false;
+                    ctxs[base + j]->datalen = 0;
+                }
+                else {
+                    off[j] += 64;
+                }
+            }
+        }
+
+        // c. ʣ಻һĲַ뻺
+        for (size_t j = 0; j < n; ++j) {
+            if (!flushed[j]) continue;
+            SHA256_CTX* ctx = ctxs[base + j];
+            memcpy(ctx->data, data[base + j] + off[j], lens[base + j] - off[j]);
+            ctx->datalen = (uint32)(lens[base + j] - off[j]);
+        }
+    }
+}
+
+// ·: ·󣬵һһѹҪڶ·һѹһ
+void sha256_final_multi(SHA256_CTX* const ctxs[], uint8* const hashes[], size_t count) {
+    for (size_t base = 0; base < count; base += SHA256_LANES) {
+        size_t n = (count - base < SHA256_LANES) ? count - base : SHA256_LANES;
+        uint8 extra[SHA256_LANES][64];
+        int nblocks[SHA256_LANES];
+        uint32* states[SHA256_LANES];
+        const uint8* blocks[SHA256_LANES];
+        int lanes;
+
+        for (size_t j = 0; j < n; ++j) {
+            nblocks[j] = sha256_pad(ctxs[base + j], extra[j]);
+            states[j] = ctxs[base + j]->state;
+            blocks[j] = ctxs[base + j]->data;
+        }
+        sha256_transform_lanes(states, blocks, (int)n);
+
+        lanes = 0;
+        for (size_t j = 0; j < n; ++j) {
+            if (nblocks[j] != 2) continue;
+            states[lanes] = ctxs[base + j]->state;
+            blocks[lanes++] = extra[j];
+        }
+        if (lanes > 0) sha256_transform_lanes(states, blocks, lanes);
+
+        for (size_t j = 0; j < n; ++j) {
+            sha256_output(ctxs[base + j]->state, hashes[base + j]);
+        }
+    }
+}
+
+// =======================================================
+// --- SHA-512  (SHA-512 / SHA-384 / SHA-512/256) ---
+// =======================================================
+
+// --- SHA-512  K (80, ǰ80Сֵǰ64λ) ---
+static const uint64 K512[80] = {
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+    0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+    0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+    0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+    0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+    0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+    0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+    0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+    0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+    0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+    0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+    0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+    0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+    0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+// --- ʼϣֵ ---
+// SHA-512: ǰ8ƽСֵǰ64λ
+static const uint64 SHA512_IV[8] = {
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+    0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+// SHA-384: 9~16ƽСֵǰ64λ
+static const uint64 SHA384_IV[8] = {
+    0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL, 0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+    0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL, 0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL
+};
+// SHA-512/256:  FIPS 180-4  SHA-512/t IV ɺõ
+static const uint64 SHA512_256_IV[8] = {
+    0x22312194fc2bf72cULL, 0x9f555fa3c84c64c2ULL, 0x2393b86b6f53b151ULL, 0x963877195940eabdULL,
+    0x96283ee2a88effe3ULL, 0xbe5e1e2553863992ULL, 0x2b0199fc2c85b8aaULL, 0x0eb72ddc81c52ca2ULL
+};
+
+// ---  (64λְ汾) ---
+#define ROTR64(a,b) (((a) >> (b)) | ((a) << (64-(b))))
+#define EP0_64(x) (ROTR64(x,28) ^ ROTR64(x,34) ^ ROTR64(x,39))
+#define EP1_64(x) (ROTR64(x,14) ^ ROTR64(x,18) ^ ROTR64(x,41))
+#define SIG0_64(x) (ROTR64(x,1) ^ ROTR64(x,8) ^ ((x) >> 7))
+#define SIG1_64(x) (ROTR64(x,19) ^ ROTR64(x,61) ^ ((x) >> 6))
+
+// --- ı任: һ 1024 λ (128ֽ) Ŀ ---
+static void sha512_transform(SHA512_CTX* ctx, const uint8* data) {
+    uint64 a, b, c, d, e, f, g, h, t1, t2, m[80];
+    int i, j;
+
+    // 1. ׼Ϣȱ W[0..79] (64λ, Big Endian)
+    for (i = 0, j = 0; i < 16; ++i, j += 8) {
+        m[i] = ((uint64)data[j] << 56) | ((uint64)data[j + 1] << 48) |
+            ((uint64)data[j + 2] << 40) | ((uint64)data[j + 3] << 32) |
+            ((uint64)data[j + 4] << 24) | ((uint64)data[j + 5] << 16) |
+            ((uint64)data[j + 6] << 8) | ((uint64)data[j + 7]);
+    }
+    for (; i < 80; ++i)
+        m[i] = SIG1_64(m[i - 2]) + m[i - 7] + SIG0_64(m[i - 15]) + m[i - 16];
+
+    // 2. ʼ
+    a = ctx->state[0];
+    b = ctx->state[1];
+    c = ctx->state[2];
+    d = ctx->state[3];
+    e = ctx->state[4];
+    f = ctx->state[5];
+    g = ctx->state[6];
+    h = ctx->state[7];
+
+    // 3. ѭ (80)CH / MAJ  SHA-256 
+    for (i = 0; i < 80; ++i) {
+        t1 = h + EP1_64(e) + CH(e, f, g) + K512[i] + m[i];
+        t2 = EP0_64(a) + MAJ(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    // 4. ״̬ (ۼ)
+    ctx->state[0] += a;
+    ctx->state[1] += b;
+    ctx->state[2] += c;
+    ctx->state[3] += d;
+    ctx->state[4] += e;
+    ctx->state[5] += f;
+    ctx->state[6] += g;
+    ctx->state[7] += h;
+}
+
+// 128 λؼۼ (λ 64 λ)
+static void sha512_add_bits(SHA512_CTX* ctx, uint64 bits) {
+    ctx->bitlen[0] += bits;
+    if (ctx->bitlen[0] < bits) ctx->bitlen[1]++;
+}
+
+static void sha512_init_with_iv(SHA512_CTX* ctx, const uint64 iv[8]) {
+    ctx->datalen = 0;
+    ctx->bitlen[0] = 0;
+    ctx->bitlen[1] = 0;
+    memcpy(ctx->state, iv, sizeof(ctx->state));
+}
+
+// 䲢ǰ out_len ֽ (SHA-384 / SHA-512/256 ض)
+static void sha512_final_truncated(SHA512_CTX* ctx, uint8* hash, size_t out_len) {
+    uint32 i = ctx->datalen;
+    uint8 digest[SHA512_BLOCK_SIZE];
+
+    //  SHA-256 ֻͬǿ鳤 128 ֽڡֶ 16 ֽ
+    sha512_add_bits(ctx, (uint64)ctx->datalen * 8);
+
+    ctx->data[i++] = 0x80;
+    if (i > 112) {
+        while (i < 128) ctx->data[i++] = 0x00;
+        sha512_transform(ctx, ctx->data);
+        i = 0;
+    }
+    while (i < 112) ctx->data[i++] = 0x00;
+
+    //  16 ֽڷ 128 λܳ (Big Endian)
+    for (i = 0; i < 8; ++i) {
+        ctx->data[127 - i] = (uint8)(ctx->bitlen[0] >> (i * 8));
+        ctx->data[119 - i] = (uint8)(ctx->bitlen[1] >> (i * 8));
+    }
+    sha512_transform(ctx, ctx->data);
 
     //  (Big Endian)
-    for (i = 0; i < 4; ++i) {
-        hash[i * 4] = (ctx->state[i] >> 24) & 0xFF;
-        hash[i * 4 + 1] = (ctx->state[i] >> 16) & 0xFF;
-        hash[i * 4 + 2] = (ctx->state[i] >> 8) & 0xFF;
-        hash[i * 4 + 3] = (ctx->state[i]) & 0xFF;
-    }
-    // 4״̬
-    for (i = 0; i < 4; ++i) {
-        hash[16 + i * 4] = (ctx->state[4 + i] >> 24) & 0xFF;
-        hash[16 + i * 4 + 1] = (ctx->state[4 + i] >> 16) & 0xFF;
-        hash[16 + i * 4 + 2] = (ctx->state[4 + i] >> 8) & 0xFF;
-        hash[16 + i * 4 + 3] = (ctx->state[4 + i]) & 0xFF;
+    for (i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            digest[i * 8 + j] = (uint8)(ctx->state[i] >> (56 - j * 8));
+        }
+    }
+    memcpy(hash, digest, out_len);
+}
+
+// 1. ʼ
+void sha512_init(SHA512_CTX* ctx) {
+    sha512_init_with_iv(ctx, SHA512_IV);
+}
+
+// 2.  ( sha256_update ͬ㿽·)
+void sha512_update(SHA512_CTX* ctx, const uint8* data, size_t len) {
+    size_t i = 0;
+
+    // a. Ȱϴβİ鲹
+    if (ctx->datalen > 0) {
+        size_t fill = 128 - ctx->datalen;
+        if (fill > len) fill = len;
+        memcpy(ctx->data + ctx->datalen, data, fill);
+        ctx->datalen += (uint32)fill;
+        i = fill;
+
+        if (ctx->datalen < 128) return;
+        sha512_transform(ctx, ctx->data);
+        sha512_add_bits(ctx, 1024);
+        ctx->datalen = 0;
+    }
+
+    // b. ֱӴڲ
+    for (; len - i >= 128; i += 128) {
+        sha512_transform(ctx, data + i);
+        sha512_add_bits(ctx, 1024);
     }
+
+    // c. ʣ಻һĲַ뻺
+    memcpy(ctx->data, data + i, len - i);
+    ctx->datalen = (uint32)(len - i);
+}
+
+// 3. 
+void sha512_final(SHA512_CTX* ctx, uint8 hash[SHA512_BLOCK_SIZE]) {
+    sha512_final_truncated(ctx, hash, SHA512_BLOCK_SIZE);
+}
+
+// --- SHA-384 ---
+void sha384_init(SHA512_CTX* ctx) {
+    sha512_init_with_iv(ctx, SHA384_IV);
+}
+
+void sha384_update(SHA512_CTX* ctx, const uint8* data, size_t len) {
+    sha512_update(ctx, data, len);
+}
+
+void sha384_final(SHA512_CTX* ctx, uint8 hash[SHA384_BLOCK_SIZE]) {
+    sha512_final_truncated(ctx, hash, SHA384_BLOCK_SIZE);
+}
+
+// --- SHA-512/256 ---
+void sha512_256_init(SHA512_CTX* ctx) {
+    sha512_init_with_iv(ctx, SHA512_256_IV);
+}
+
+void sha512_256_update(SHA512_CTX* ctx, const uint8* data, size_t len) {
+    sha512_update(ctx, data, len);
+}
+
+void sha512_256_final(SHA512_CTX* ctx, uint8 hash[SHA512_256_BLOCK_SIZE]) {
+    sha512_final_truncated(ctx, hash, SHA512_256_BLOCK_SIZE);
 }
\ No newline at end of file
@@ -16,6 +16,22 @@ typedef struct {
     uint32 state[8];    // 8 32λ ڲ״̬Ĵ (A..H)
 } SHA256_CTX;
 
+// · SHA-256 һβѹ· (8 · x 32 λ = һ AVX2 Ĵ)
+#define SHA256_LANES 8
+
+// SHA-512 С
+#define SHA512_BLOCK_SIZE 64      // SHA-512:     512λ = 64ֽ
+#define SHA384_BLOCK_SIZE 48      // SHA-384:     384λ = 48ֽ
+#define SHA512_256_BLOCK_SIZE 32  // SHA-512/256: 256λ = 32ֽ
+
+// SHA-512 干õĽṹ (SHA-384 / SHA-512/256 ֻǳʼֵͽضϳȲͬ)
+typedef struct {
+    uint8 data[128];    // ǰݿ黺 (1024λ)
+    uint32 datalen;     // ǰݳ
+    uint64 bitlen[2];   // ܱ (128λ: [0] 64λ, [1] 64λ)
+    uint64 state[8];    // 8 64λ ڲ״̬Ĵ (A..H)
+} SHA512_CTX;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -41,6 +57,53 @@ extern "C" {
      */
     void sha256_final(SHA256_CTX* ctx, uint8 hash[SHA256_BLOCK_SIZE]);
 
+    // --- · SHA-256  (ĶϢ) ---
+
+    /**
+     * ·ѹ:  lanes ״̬ѹһ 64 ֽڿ
+     * @param states: · 8  32 λ״̬
+     * @param blocks: ·
+     * @param lanes: · (1 ~ SHA256_LANES)
+     */
+    void sha256_transform_lanes(uint32* const states[], const uint8* const blocks[], int lanes);
+
+    /**
+     * ·: ȼڶÿķֱ sha256_update鲿ְ·ѹ
+     * @param ctxs: count 
+     * @param data / lens: ĶӦ볤
+     */
+    void sha256_update_multi(SHA256_CTX* const ctxs[], const uint8* const data[], const size_t lens[], size_t count);
+
+    /**
+     * ·: ȼڶÿķֱ sha256_final
+     * @param hashes: · 32 ֽժҪ
+     */
+    void sha256_final_multi(SHA256_CTX* const ctxs[], uint8* const hashes[], size_t count);
+
+    // --- SHA-512  (64λ㣬 64 λ CPU ÿֽڿ SHA-256) ---
+
+    /**
+     * SHA-512 ʼ /  / 
+     * ÷ SHA-256 ȫһ: init -> update (ɶ) -> final
+     */
+    void sha512_init(SHA512_CTX* ctx);
+    void sha512_update(SHA512_CTX* ctx, const uint8* data, size_t len);
+    void sha512_final(SHA512_CTX* ctx, uint8 hash[SHA512_BLOCK_SIZE]);
+
+    /**
+     * SHA-384:  SHA-512 ѹʼֵͬضΪ 48 ֽ
+     */
+    void sha384_init(SHA512_CTX* ctx);
+    void sha384_update(SHA512_CTX* ctx, const uint8* data, size_t len);
+    void sha384_final(SHA512_CTX* ctx, uint8 hash[SHA384_BLOCK_SIZE]);
+
+    /**
+     * SHA-512/256:  SHA-512 ѹʼֵͬضΪ 32 ֽ
+     */
+    void sha512_256_init(SHA512_CTX* ctx);
+    void sha512_256_update(SHA512_CTX* ctx, const uint8* data, size_t len);
+    void sha512_256_final(SHA512_CTX* ctx, uint8 hash[SHA512_256_BLOCK_SIZE]);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,22 +5,18 @@
 // SHA-256 ڲС 512 λ = 64 ֽ
 #define SHA256_INPUT_BLOCK_SIZE 64
 
-void hmac_sha256(const uint8* key, size_t key_len,
-    const uint8* msg, size_t msg_len,
-    uint8* output) {
-
-    SHA256_CTX ctx;
-    uint8 k_prime[SHA256_INPUT_BLOCK_SIZE]; // Կ K'
+// 1. Կ: Ԥѹ ipad / opad 
+void hmac_sha256_set_key(HMAC_SHA256_CTX* ctx, const uint8* key, size_t key_len) {
+    uint8 k_prime[SHA256_INPUT_BLOCK_SIZE]; // Կ K'
     uint8 k_ipad[SHA256_INPUT_BLOCK_SIZE];  // K' XOR ipad
     uint8 k_opad[SHA256_INPUT_BLOCK_SIZE];  // K' XOR opad
-    uint8 inner_hash[SHA256_BLOCK_SIZE];    // һ Hash 
 
-    // 1. Կ Key
+    // a. Կ Key
     // Կ > 64һ Hash  32 ֽ
     if (key_len > SHA256_INPUT_BLOCK_SIZE) {
-        sha256_init(&ctx);
-        sha256_update(&ctx, key, key_len);
-        sha256_final(&ctx, k_prime);
+        sha256_init(&ctx->ctx);
+        sha256_update(&ctx->ctx, key, key_len);
+        sha256_final(&ctx->ctx, k_prime);
         // ʣಿֲ 0
         memset(k_prime + SHA256_BLOCK_SIZE, 0, SHA256_INPUT_BLOCK_SIZE - SHA256_BLOCK_SIZE);
     }
@@ -30,24 +26,178 @@ void hmac_sha256(const uint8* key, size_t key_len,
         memset(k_prime + key_len, 0, SHA256_INPUT_BLOCK_SIZE - key_len);
     }
 
-    // 2. ׼ Inner Pad (ipad)  Outer Pad (opad)
+    // b. ׼ Inner Pad (ipad)  Outer Pad (opad)
     // ipad = 0x36, opad = 0x5c
     for (int i = 0; i < SHA256_INPUT_BLOCK_SIZE; i++) {
         k_ipad[i] = k_prime[i] ^ 0x36;
         k_opad[i] = k_prime[i] ^ 0x5c;
     }
 
-    // 3.  Inner Hash
-    // Hash(k_ipad || message)
-    sha256_init(&ctx);
-    sha256_update(&ctx, k_ipad, SHA256_INPUT_BLOCK_SIZE);
-    sha256_update(&ctx, msg, msg_len);
-    sha256_final(&ctx, inner_hash);
-
-    // 4.  Outer Hash (ս)
-    // Hash(k_opad || inner_hash)
-    sha256_init(&ctx);
-    sha256_update(&ctx, k_opad, SHA256_INPUT_BLOCK_SIZE);
-    sha256_update(&ctx, inner_hash, SHA256_BLOCK_SIZE);
-    sha256_final(&ctx, output);
+    // c. ѹһΣм״̬ (֮ÿϢֱӿ¡)
+    sha256_init(&ctx->ipad_ctx);
+    sha256_update(&ctx->ipad_ctx, k_ipad, SHA256_INPUT_BLOCK_SIZE);
+    sha256_init(&ctx->opad_ctx);
+    sha256_update(&ctx->opad_ctx, k_opad, SHA256_INPUT_BLOCK_SIZE);
+
+    ctx->ctx = ctx->ipad_ctx;
+}
+
+// 2. ʼϢ: ¡ڲм״̬
+void hmac_sha256_init(HMAC_SHA256_CTX* ctx) {
+    ctx->ctx = ctx->ipad_ctx;
+}
+
+// 3. Inner Hash ʽ: Hash(k_ipad || message)
+void hmac_sha256_update(HMAC_SHA256_CTX* ctx, const uint8* msg, size_t msg_len) {
+    sha256_update(&ctx->ctx, msg, msg_len);
+}
+
+// 4. Outer Hash (ս): Hash(k_opad || inner_hash)
+void hmac_sha256_final(HMAC_SHA256_CTX* ctx, uint8* output) {
+    uint8 inner_hash[SHA256_BLOCK_SIZE];
+    SHA256_CTX outer = ctx->opad_ctx;
+
+    sha256_final(&ctx->ctx, inner_hash);
+    sha256_update(&outer, inner_hash, SHA256_BLOCK_SIZE);
+    sha256_final(&outer, output);
+}
+
+void hmac_sha256(const uint8* key, size_t key_len,
+    const uint8* msg, size_t msg_len,
+    uint8* output) {
+
+    HMAC_SHA256_CTX ctx;
+
+    hmac_sha256_set_key(&ctx, key, key_len);
+    hmac_sha256_update(&ctx, msg, msg_len);
+    hmac_sha256_final(&ctx, output);
+}
+
+// =======================================================
+// --- HMAC-SHA512 ---
+// =======================================================
+
+// SHA-512 ڲС 1024 λ = 128 ֽ
+#define SHA512_INPUT_BLOCK_SIZE 128
+
+void hmac_sha512_set_key(HMAC_SHA512_CTX* ctx, const uint8* key, size_t key_len) {
+    uint8 k_prime[SHA512_INPUT_BLOCK_SIZE];
+    uint8 k_ipad[SHA512_INPUT_BLOCK_SIZE];
+    uint8 k_opad[SHA512_INPUT_BLOCK_SIZE];
+
+    // Կ > 128 ʱ Hash  64 ֽڣಹ 0
+    if (key_len > SHA512_INPUT_BLOCK_SIZE) {
+        sha512_init(&ctx->ctx);
+        sha512_update(&ctx->ctx, key, key_len);
+        sha512_final(&ctx->ctx, k_prime);
+        memset(k_prime + SHA512_BLOCK_SIZE, 0, SHA512_INPUT_BLOCK_SIZE - SHA512_BLOCK_SIZE);
+    }
+    else {
+        memcpy(k_prime, key, key_len);
+        memset(k_prime + key_len, 0, SHA512_INPUT_BLOCK_SIZE - key_len);
+    }
+
+    for (int i = 0; i < SHA512_INPUT_BLOCK_SIZE; i++) {
+        k_ipad[i] = k_prime[i] ^ 0x36;
+        k_opad[i] = k_prime[i] ^ 0x5c;
+    }
+
+    sha512_init(&ctx->ipad_ctx);
+    sha512_update(&ctx->ipad_ctx, k_ipad, SHA512_INPUT_BLOCK_SIZE);
+    sha512_init(&ctx->opad_ctx);
+    sha512_update(&ctx->opad_ctx, k_opad, SHA512_INPUT_BLOCK_SIZE);
+
+    ctx->ctx = ctx->ipad_ctx;
+}
+
+void hmac_sha512_init(HMAC_SHA512_CTX* ctx) {
+    ctx->ctx = ctx->ipad_ctx;
+}
+
+void hmac_sha512_update(HMAC_SHA512_CTX* ctx, const uint8* msg, size_t msg_len) {
+    sha512_update(&ctx->ctx, msg, msg_len);
+}
+
+void hmac_sha512_final(HMAC_SHA512_CTX* ctx, uint8* output) {
+    uint8 inner_hash[SHA512_BLOCK_SIZE];
+    SHA512_CTX outer = ctx->opad_ctx;
+
+    sha512_final(&ctx->ctx, inner_hash);
+    sha512_update(&outer, inner_hash, SHA512_BLOCK_SIZE);
+    sha512_final(&outer, output);
+}
+
+void hmac_sha512(const uint8* key, size_t key_len,
+    const uint8* msg, size_t msg_len,
+    uint8* output) {
+
+    HMAC_SHA512_CTX ctx;
+
+    hmac_sha512_set_key(&ctx, key, key_len);
+    hmac_sha512_update(&ctx, msg, msg_len);
+    hmac_sha512_final(&ctx, output);
+}
+
+// ֤: ڸϼ㣬Կıֻ
+bool hmac_sha256_verify(const HMAC_SHA256_CTX* key, const uint8* msg, size_t msg_len, const uint8* tag) {
+    HMAC_SHA256_CTX ctx = *key;
+    uint8 mac[HMAC_OUTPUT_SIZE];
+
+    hmac_sha256_init(&ctx);
+    hmac_sha256_update(&ctx, msg, msg_len);
+    hmac_sha256_final(&ctx, mac);
+    return constant_time_equal(mac, tag, HMAC_OUTPUT_SIZE);
+}
+
+// ÿ鴦Ŀ (ջϹС)ȡ··
+#define HMAC_BATCH_GROUP (SHA256_LANES * 8)
+
+// ֤
+// 1. ڲ: ÿӸԵ ipad м״̬Ϣ鰴·ѹ
+// 2. :  opad м״̬ 32 ֽڲժҪһ (·) ѹ
+// 3. յ tag ʱȽϣдλͼ
+size_t hmac_sha256_verify_batch(const HMAC_SHA256_VERIFY_ITEM* items, size_t count, uint8* result_bitmap) {
+    SHA256_CTX work[HMAC_BATCH_GROUP];
+    SHA256_CTX* ctxs[HMAC_BATCH_GROUP];
+    const uint8* data[HMAC_BATCH_GROUP];
+    size_t lens[HMAC_BATCH_GROUP];
+    uint8 digests[HMAC_BATCH_GROUP][SHA256_BLOCK_SIZE];
+    uint8* outs[HMAC_BATCH_GROUP];
+    size_t passed = 0;
+
+    memset(result_bitmap, 0, (count + 7) / 8);
+
+    for (size_t base = 0; base < count; base += HMAC_BATCH_GROUP) {
+        size_t n = (count - base < HMAC_BATCH_GROUP) ? count - base : HMAC_BATCH_GROUP;
+
+        // ڲϣ
+        for (size_t j = 0; j < n; ++j) {
+            work[j] = items[base + j].key->ipad_ctx;
+            ctxs[j] = &work[j];
+            data[j] = items[base + j].msg;
+            lens[j] = items[base + j].msg_len;
+            outs[j] = digests[j];
+        }
+        sha256_update_multi(ctxs, data, lens, n);
+        sha256_final_multi(ctxs, outs, n);
+
+        // ϣ
+        for (size_t j = 0; j < n; ++j) {
+            work[j] = items[base + j].key->opad_ctx;
+            data[j] = digests[j];
+            lens[j] = SHA256_BLOCK_SIZE;
+        }
+        sha256_update_multi(ctxs, data, lens, n);
+        sha256_final_multi(ctxs, outs, n);
+
+        // ʱȽϲ¼
+        for (size_t j = 0; j < n; ++j) {
+            size_t i = base + j;
+            if (constant_time_equal(digests[j], items[i].tag, HMAC_OUTPUT_SIZE)) {
+                result_bitmap[i / 8] |= (uint8)(1u << (i % 8));
+                passed++;
+            }
+        }
+    }
+    return passed;
 }
\ No newline at end of file
@@ -9,6 +9,33 @@
 // HMAC-SHA256 ȵ SHA256 ժҪ (32ֽ)
 #define HMAC_OUTPUT_SIZE SHA256_BLOCK_SIZE
 
+// ԤԿ HMAC-SHA256 
+// K' XOR ipad / K' XOR opad  64 ֽڿԿʱѹһΣ
+// ֮ÿϢֻм״̬ (midstate) ¡ʡȥÿ 2 ζѹ
+typedef struct {
+    SHA256_CTX ipad_ctx; //  K' XOR ipad ڲм״̬ (ÿԿֻһ)
+    SHA256_CTX opad_ctx; //  K' XOR opad м״̬ (ÿԿֻһ)
+    SHA256_CTX ctx;      // ǰϢڲʽ
+} HMAC_SHA256_CTX;
+
+// HMAC-SHA512  (64ֽ)
+#define HMAC_SHA512_OUTPUT_SIZE SHA512_BLOCK_SIZE
+
+// ԤԿ HMAC-SHA512  (ṹ HMAC_SHA256_CTX ͬ鳤 128 ֽ)
+typedef struct {
+    SHA512_CTX ipad_ctx; //  K' XOR ipad ڲм״̬
+    SHA512_CTX opad_ctx; //  K' XOR opad м״̬
+    SHA512_CTX ctx;      // ǰϢڲʽ
+} HMAC_SHA512_CTX;
+
+// ֤ĵĿ: (Կ, Ϣ, ֤ MAC)
+typedef struct {
+    const HMAC_SHA256_CTX* key; // ѵ hmac_sha256_set_key Կ (Ŀɹ)
+    const uint8* msg;           // Ϣ
+    size_t msg_len;             // Ϣ
+    const uint8* tag;           // յ 32 ֽ MAC
+} HMAC_SHA256_VERIFY_ITEM;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -25,6 +52,63 @@ extern "C" {
         const uint8* msg, size_t msg_len,
         uint8* output);
 
+    // --- ԤԿʽӿ ---
+
+    /**
+     * 1. Կ (ÿԿֻһ)
+     *  K' ѹ ipad / opad 飬м״̬
+     */
+    void hmac_sha256_set_key(HMAC_SHA256_CTX* ctx, const uint8* key, size_t key_len);
+
+    /**
+     * 2. ʼһϢ:  ipad м״̬¡ڲ
+     */
+    void hmac_sha256_init(HMAC_SHA256_CTX* ctx);
+
+    /**
+     * 3. ׷Ϣ (ɶε)
+     */
+    void hmac_sha256_update(HMAC_SHA256_CTX* ctx, const uint8* msg, size_t msg_len);
+
+    /**
+     * 4.  MAC (32 ֽ)
+     * Կм״ֲ̬䣬һϢµ hmac_sha256_init 
+     */
+    void hmac_sha256_final(HMAC_SHA256_CTX* ctx, uint8* output);
+
+    // --- HMAC-SHA512 (÷ HMAC-SHA256 ȫһ) ---
+
+    /**
+     *  HMAC-SHA512
+     * @param output:  ( 64 ֽ)
+     */
+    void hmac_sha512(const uint8* key, size_t key_len,
+        const uint8* msg, size_t msg_len,
+        uint8* output);
+
+    void hmac_sha512_set_key(HMAC_SHA512_CTX* ctx, const uint8* key, size_t key_len);
+    void hmac_sha512_init(HMAC_SHA512_CTX* ctx);
+    void hmac_sha512_update(HMAC_SHA512_CTX* ctx, const uint8* msg, size_t msg_len);
+    void hmac_sha512_final(HMAC_SHA512_CTX* ctx, uint8* output);
+
+    // --- ֤ ---
+
+    /**
+     * ֤Ϣ MAC (ʱȽ)
+     * @param key: Կ (ֻᱻ޸)
+     * @return true ֤ͨ, false ֤ʧ
+     */
+    bool hmac_sha256_verify(const HMAC_SHA256_CTX* key, const uint8* msg, size_t msg_len, const uint8* tag);
+
+    /**
+     * ֤: ڲϣ· SHA-256 沢ѹ
+     * @param items: count ֤Ŀ
+     * @param result_bitmap: λͼ (count + 7) / 8 ֽ;
+     *                        i ͨ result_bitmap[i / 8] ĵ (i % 8) λΪ 1
+     * @return ֤ͨĿ
+     */
+    size_t hmac_sha256_verify_batch(const HMAC_SHA256_VERIFY_ITEM* items, size_t count, uint8* result_bitmap);
+
 #ifdef __cplusplus
 }
 #endif
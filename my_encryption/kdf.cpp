@@ -0,0 +1,276 @@
+#include "kdf.h"
+#include <string.h>
+
+// 32 λ״ְ̬д
+static void store_state_be(uint8* dst, const uint32 state[8]) {
+    for (int i = 0; i < 8; i++) {
+        dst[i * 4] = (uint8)(state[i] >> 24);
+        dst[i * 4 + 1] = (uint8)(state[i] >> 16);
+        dst[i * 4 + 2] = (uint8)(state[i] >> 8);
+        dst[i * 4 + 3] = (uint8)(state[i]);
+    }
+}
+
+// Ϊ 32 ֽڵ HMAC Ϣ׼ĵ:
+// [0..31] Ϣ, 0x80,  0,  8 ֽܳ (64 ֽ pad  + 32 ֽ = 768 bits)
+static void init_padded_block(uint8 block[64]) {
+    memset(block, 0, 64);
+    block[SHA256_BLOCK_SIZE] = 0x80;
+    block[62] = 0x03;
+    block[63] = 0x00;
+}
+
+// --- PBKDF2-HMAC-SHA256 ---
+void pbkdf2_hmac_sha256(const uint8* password, size_t password_len,
+    const uint8* salt, size_t salt_len,
+    uint32 iterations,
+    uint8* output, size_t output_len) {
+
+    HMAC_SHA256_CTX key;
+    hmac_sha256_set_key(&key, password, password_len);
+
+    uint32 block_count = (uint32)((output_len + SHA256_BLOCK_SIZE - 1) / SHA256_BLOCK_SIZE);
+
+    // ÿβм SHA256_LANES 
+    for (uint32 first = 1; first <= block_count; first += SHA256_LANES) {
+        int lanes = (block_count - first + 1 < SHA256_LANES) ? (int)(block_count - first + 1) : SHA256_LANES;
+        uint8 u_block[SHA256_LANES][64];   // ڲ: U(j-1) + 
+        uint8 h_block[SHA256_LANES][64];   // : ڲժҪ + 
+        uint32 inner[SHA256_LANES][8];
+        uint32 outer[SHA256_LANES][8];
+        uint32 t[SHA256_LANES][8];         // ۻ Ti (״̬)
+        uint32* inner_ptr[SHA256_LANES];
+        uint32* outer_ptr[SHA256_LANES];
+        const uint8* u_ptr[SHA256_LANES];
+        const uint8* h_ptr[SHA256_LANES];
+
+        // 1. U1 = HMAC(P, S || INT(i))γ⣬ͨʽӿ
+        for (int l = 0; l < lanes; l++) {
+            uint32 i = first + (uint32)l;
+            uint8 be_i[4] = { (uint8)(i >> 24), (uint8)(i >> 16), (uint8)(i >> 8), (uint8)i };
+
+            init_padded_block(u_block[l]);
+            init_padded_block(h_block[l]);
+            hmac_sha256_init(&key);
+            hmac_sha256_update(&key, salt, salt_len);
+            hmac_sha256_update(&key, be_i, 4);
+            hmac_sha256_final(&key, u_block[l]);
+
+            //  U1 ֽڻָ״̬Ϊ T ĳֵ
+            for (int w = 0; w < 8; w++) {
+                t[l][w] = ((uint32)u_block[l][w * 4] << 24) | ((uint32)u_block[l][w * 4 + 1] << 16) |
+                    ((uint32)u_block[l][w * 4 + 2] << 8) | ((uint32)u_block[l][w * 4 + 3]);
+            }
+            inner_ptr[l] = inner[l];
+            outer_ptr[l] = outer[l];
+            u_ptr[l] = u_block[l];
+            h_ptr[l] = h_block[l];
+        }
+
+        // 2. Uj = HMAC(P, U(j-1)): м״̬һζ·ѹ
+        for (uint32 j = 1; j < iterations; j++) {
+            for (int l = 0; l < lanes; l++) memcpy(inner[l], key.ipad_ctx.state, sizeof(inner[l]));
+            sha256_transform_lanes(inner_ptr, u_ptr, lanes);
+            for (int l = 0; l < lanes; l++) store_state_be(h_block[l], inner[l]);
+
+            for (int l = 0; l < lanes; l++) memcpy(outer[l], key.opad_ctx.state, sizeof(outer[l]));
+            sha256_transform_lanes(outer_ptr, h_ptr, lanes);
+            for (int l = 0; l < lanes; l++) {
+                store_state_be(u_block[l], outer[l]);
+                for (int w = 0; w < 8; w++) t[l][w] ^= outer[l][w];
+            }
+        }
+
+        // 3.  Ti (һֻȡһ)
+        for (int l = 0; l < lanes; l++) {
+            uint8 ti[SHA256_BLOCK_SIZE];
+            size_t pos = (size_t)(first - 1 + l) * SHA256_BLOCK_SIZE;
+            size_t n = (output_len - pos < SHA256_BLOCK_SIZE) ? output_len - pos : SHA256_BLOCK_SIZE;
+            store_state_be(ti, t[l]);
+            memcpy(output + pos, ti, n);
+        }
+    }
+}
+
+// =======================================================
+// --- HKDF-SHA256 / HKDF-SHA512 ---
+// =======================================================
+
+// 1. ȡ
+void hkdf_sha256_extract(const uint8* salt, size_t salt_len,
+    const uint8* ikm, size_t ikm_len,
+    uint8 prk[SHA256_BLOCK_SIZE]) {
+    //  HashLen  0 ֽڵȼ (HMAC ԿͻᲹ 0 鳤)
+    hmac_sha256(salt, salt_len, ikm, ikm_len, prk);
+}
+
+// 2. չ: PRK ֻÿִм״̬¡T(i) ͬһջ
+bool hkdf_sha256_expand(const HMAC_SHA256_CTX* prk_ctx,
+    const uint8* info, size_t info_len,
+    uint8* okm, size_t okm_len) {
+    if (okm_len > 255 * SHA256_BLOCK_SIZE) return false;
+
+    HMAC_SHA256_CTX ctx = *prk_ctx;
+    uint8 t[SHA256_BLOCK_SIZE];
+    size_t t_len = 0; // T(0) Ϊմ
+
+    for (uint8 i = 1; okm_len > 0; i++) {
+        size_t n = (okm_len < SHA256_BLOCK_SIZE) ? okm_len : SHA256_BLOCK_SIZE;
+
+        hmac_sha256_init(&ctx);
+        hmac_sha256_update(&ctx, t, t_len);
+        hmac_sha256_update(&ctx, info, info_len);
+        hmac_sha256_update(&ctx, &i, 1);
+        hmac_sha256_final(&ctx, t);
+        t_len = SHA256_BLOCK_SIZE;
+
+        memcpy(okm, t, n);
+        okm += n;
+        okm_len -= n;
+    }
+    return true;
+}
+
+// ÿ鲢дıǩ (ջϹС)
+#define HKDF_LABEL_GROUP (SHA256_LANES * 4)
+
+// 3. չ
+// һǩĵ i ֻ: ڲ (T(i-1) || info || i)  (ڲժҪ) ߶·ӿ
+bool hkdf_sha256_expand_labels(const HMAC_SHA256_CTX* prk_ctx,
+    const HKDF_LABEL* labels, size_t count) {
+    SHA256_CTX work[HKDF_LABEL_GROUP];
+    SHA256_CTX* ctxs[HKDF_LABEL_GROUP];
+    const uint8* data[HKDF_LABEL_GROUP];
+    size_t lens[HKDF_LABEL_GROUP];
+    uint8 t[HKDF_LABEL_GROUP][SHA256_BLOCK_SIZE];
+    uint8* outs[HKDF_LABEL_GROUP];
+    uint8 counter[HKDF_LABEL_GROUP];
+    size_t active[HKDF_LABEL_GROUP];
+
+    for (size_t i = 0; i < count; i++) {
+        if (labels[i].okm_len > 255 * SHA256_BLOCK_SIZE) return false;
+    }
+
+    for (size_t base = 0; base < count; base += HKDF_LABEL_GROUP) {
+        size_t n = (count - base < HKDF_LABEL_GROUP) ? count - base : HKDF_LABEL_GROUP;
+
+        for (uint32 round = 1; ; round++) {
+            size_t pos = (size_t)(round - 1) * SHA256_BLOCK_SIZE;
+            size_t m = 0;
+
+            // Ҫ round ıǩ
+            for (size_t j = 0; j < n; j++) {
+                if (labels[base + j].okm_len > pos) active[m++] = j;
+            }
+            if (m == 0) break;
+
+            // ڲ: ipad м״̬ || T(i-1) || info || i
+            for (size_t k = 0; k < m; k++) {
+                size_t j = active[k];
+                work[k] = prk_ctx->ipad_ctx;
+                ctxs[k] = &work[k];
+                data[k] = t[j];
+                lens[k] = (round > 1) ? SHA256_BLOCK_SIZE : 0;
+                outs[k] = t[j];
+                counter[k] = (uint8)round;
+            }
+            sha256_update_multi(ctxs, data, lens, m);
+            for (size_t k = 0; k < m; k++) {
+                data[k] = labels[base + active[k]].info;
+                lens[k] = labels[base + active[k]].info_len;
+            }
+            sha256_update_multi(ctxs, data, lens, m);
+            for (size_t k = 0; k < m; k++) {
+                data[k] = &counter[k];
+                lens[k] = 1;
+            }
+            sha256_update_multi(ctxs, data, lens, m);
+            sha256_final_multi(ctxs, outs, m);
+
+            // : opad м״̬ || ڲժҪ -> T(i)
+            for (size_t k = 0; k < m; k++) {
+                work[k] = prk_ctx->opad_ctx;
+                data[k] = t[active[k]];
+                lens[k] = SHA256_BLOCK_SIZE;
+            }
+            sha256_update_multi(ctxs, data, lens, m);
+            sha256_final_multi(ctxs, outs, m);
+
+            for (size_t k = 0; k < m; k++) {
+                const HKDF_LABEL* label = &labels[base + active[k]];
+                size_t len = (label->okm_len - pos < SHA256_BLOCK_SIZE) ? label->okm_len - pos : SHA256_BLOCK_SIZE;
+                memcpy(label->okm + pos, t[active[k]], len);
+            }
+        }
+    }
+    return true;
+}
+
+bool hkdf_sha256(const uint8* salt, size_t salt_len,
+    const uint8* ikm, size_t ikm_len,
+    const uint8* info, size_t info_len,
+    uint8* okm, size_t okm_len) {
+    uint8 prk[SHA256_BLOCK_SIZE];
+    HMAC_SHA256_CTX prk_ctx;
+
+    hkdf_sha256_extract(salt, salt_len, ikm, ikm_len, prk);
+    hmac_sha256_set_key(&prk_ctx, prk, SHA256_BLOCK_SIZE);
+    return hkdf_sha256_expand(&prk_ctx, info, info_len, okm, okm_len);
+}
+
+// --- HKDF-SHA512 ---
+void hkdf_sha512_extract(const uint8* salt, size_t salt_len,
+    const uint8* ikm, size_t ikm_len,
+    uint8 prk[SHA512_BLOCK_SIZE]) {
+    hmac_sha512(salt, salt_len, ikm, ikm_len, prk);
+}
+
+bool hkdf_sha512_expand(const HMAC_SHA512_CTX* prk_ctx,
+    const uint8* info, size_t info_len,
+    uint8* okm, size_t okm_len) {
+    if (okm_len > 255 * SHA512_BLOCK_SIZE) return false;
+
+    HMAC_SHA512_CTX ctx = *prk_ctx;
+    uint8 t[SHA512_BLOCK_SIZE];
+    size_t t_len = 0;
+
+    for (uint8 i = 1; okm_len > 0; i++) {
+        size_t n = (okm_len < SHA512_BLOCK_SIZE) ? okm_len : SHA512_BLOCK_SIZE;
+
+        hmac_sha512_init(&ctx);
+        hmac_sha512_update(&ctx, t, t_len);
+        hmac_sha512_update(&ctx, info, info_len);
+        hmac_sha512_update(&ctx, &i, 1);
+        hmac_sha512_final(&ctx, t);
+        t_len = SHA512_BLOCK_SIZE;
+
+        memcpy(okm, t, n);
+        okm += n;
+        okm_len -= n;
+    }
+    return true;
+}
+
+// SHA-512 ûж·棬ǩչ (Թͬһ PRK )
+bool hkdf_sha512_expand_labels(const HMAC_SHA512_CTX* prk_ctx,
+    const HKDF_LABEL* labels, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (labels[i].okm_len > 255 * SHA512_BLOCK_SIZE) return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        hkdf_sha512_expand(prk_ctx, labels[i].info, labels[i].info_len, labels[i].okm, labels[i].okm_len);
+    }
+    return true;
+}
+
+bool hkdf_sha512(const uint8* salt, size_t salt_len,
+    const uint8* ikm, size_t ikm_len,
+    const uint8* info, size_t info_len,
+    uint8* okm, size_t okm_len) {
+    uint8 prk[SHA512_BLOCK_SIZE];
+    HMAC_SHA512_CTX prk_ctx;
+
+    hkdf_sha512_extract(salt, salt_len, ikm, ikm_len, prk);
+    hmac_sha512_set_key(&prk_ctx, prk, SHA512_BLOCK_SIZE);
+    return hkdf_sha512_expand(&prk_ctx, info, info_len, okm, okm_len);
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#ifndef KDF_H
+#define KDF_H
+
+#include "utils.h"
+#include "hmac.h" //  HMAC-SHA256 (ԤԿ)
+#include <stdint.h>
+#include <stddef.h>
+
+// HKDF ĵǩ: ͬһ PRK °ͬ info Կ
+typedef struct {
+    const uint8* info;  // ıǩ ( "client write key")
+    size_t info_len;    // ǩ
+    uint8* okm;         // 
+    size_t okm_len;     //  (<= 255 * HashLen)
+} HKDF_LABEL;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // --- PBKDF2-HMAC-SHA256 (RFC 8018) ---
+
+    /**
+     * ӿԿ
+     * DK = T1 || T2 || ... ,  Ti = U1 ^ U2 ^ ... ^ Uc
+     * U1 = HMAC(P, S || INT(i)),  Uj = HMAC(P, U(j-1))
+     *
+     * ʵҪ:
+     * -  ipad / opad м״ֻ̬һΣÿεֻ 2 ѹ
+     * -  Ti · SHA-256 ·е
+     *
+     * @param password / password_len: 
+     * @param salt / salt_len: 
+     * @param iterations:  c (>= 1)
+     * @param output / output_len: Կ
+     */
+    void pbkdf2_hmac_sha256(const uint8* password, size_t password_len,
+        const uint8* salt, size_t salt_len,
+        uint32 iterations,
+        uint8* output, size_t output_len);
+
+    // --- HKDF (RFC 5869) ---
+
+    /**
+     * 1. ȡ (Extract): PRK = HMAC(salt, IKM)
+     * @param salt:  (Ϊգȼ HashLen  0 ֽ)
+     * @param ikm: Կ ( DH / ECDH )
+     * @param prk: αԿ (32 ֽ)
+     * ֮ hmac_sha256_set_key(ctx, prk, 32) Ϊ PRK һģ expand 
+     */
+    void hkdf_sha256_extract(const uint8* salt, size_t salt_len,
+        const uint8* ikm, size_t ikm_len,
+        uint8 prk[SHA256_BLOCK_SIZE]);
+
+    /**
+     * 2. չ (Expand): T(i) = HMAC(PRK, T(i-1) || info || i)OKM = T(1) || T(2) || ...
+     * @param prk_ctx:  PRK ùԿ (ֻ expand )
+     * @return false ʾ okm_len  255 * 32
+     */
+    bool hkdf_sha256_expand(const HMAC_SHA256_CTX* prk_ctx,
+        const uint8* info, size_t info_len,
+        uint8* okm, size_t okm_len);
+
+    /**
+     * 3. չ: һεһǩԿ
+     * ǩͬһ T(i) · SHA-256 沢м
+     * @return false ʾĳǩ okm_len  255 * 32 (ʱκν)
+     */
+    bool hkdf_sha256_expand_labels(const HMAC_SHA256_CTX* prk_ctx,
+        const HKDF_LABEL* labels, size_t count);
+
+    /**
+     * һԽӿ: extract + expand
+     */
+    bool hkdf_sha256(const uint8* salt, size_t salt_len,
+        const uint8* ikm, size_t ikm_len,
+        const uint8* info, size_t info_len,
+        uint8* okm, size_t okm_len);
+
+    // --- HKDF-SHA512 (ӿ SHA-256 汾һ£PRK Ϊ 64 ֽ) ---
+    void hkdf_sha512_extract(const uint8* salt, size_t salt_len,
+        const uint8* ikm, size_t ikm_len,
+        uint8 prk[SHA512_BLOCK_SIZE]);
+    bool hkdf_sha512_expand(const HMAC_SHA512_CTX* prk_ctx,
+        const uint8* info, size_t info_len,
+        uint8* okm, size_t okm_len);
+    bool hkdf_sha512_expand_labels(const HMAC_SHA512_CTX* prk_ctx,
+        const HKDF_LABEL* labels, size_t count);
+    bool hkdf_sha512(const uint8* salt, size_t salt_len,
+        const uint8* ikm, size_t ikm_len,
+        const uint8* info, size_t info_len,
+        uint8* okm, size_t okm_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KDF_H
\ No newline at end of file
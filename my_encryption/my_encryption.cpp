@@ -13,6 +13,11 @@ extern "C" int test_dsa_main();
 extern "C" int test_ecc_main();
 extern "C" int test_hash_main();
 extern "C" int test_hmac_main();
+extern "C" int test_kdf_main();
+extern "C" int test_nonce_main();
+extern "C" int test_ecc256_main();
+extern "C" int test_curve25519_main();
+extern "C" int test_ed25519_main();
 
 int main()
 {
@@ -24,7 +29,7 @@ int main()
         printf("\n请选择要运行的算法模块测试：\n");
         printf("---------------------------------------\n");
 
-        // --- 可测试的 9 个算法选项 ---
+        // --- 可测试的 14 个算法选项 ---
         printf("1. DES (对称加密)\n");
         printf("2. AES (对称加密)\n");
         printf("3. RSA (非对称加密/签名)\n");
@@ -34,11 +39,16 @@ int main()
         printf("7. ECC (椭圆曲线)\n");
         printf("8. HASH (散列函数)\n");
         printf("9. HMAC (消息认证)\n");
+        printf("10. KDF (密钥派生)\n");
+        printf("11. NONCE (签名随机数池)\n");
+        printf("12. ECC256 (256 位椭圆曲线)\n");
+        printf("13. X25519 (Curve25519 密钥交换)\n");
+        printf("14. Ed25519 (Edwards 曲线签名)\n");
         // -------------------------------
 
         printf("0. 退出程序\n");
         printf("---------------------------------------\n");
-        printf("请输入选项编号 (0-9): ");
+        printf("请输入选项编号 (0-14): ");
 
         // 获取用户输入
         if (!(std::cin >> choice)) {
@@ -124,9 +134,12 @@ int main()
             }
             break;
         case 8: // HASH
-            printf("\n>>> 正在运行 HASH (SHA-256) 测试...\n");
+            printf("\n>>> 正在运行 HASH (SHA-256 / SHA-512) 测试...\n");
             if (test_hash_main() == 0) {
-                printf("HASH 测试完成\n");
+                printf("HASH 测试结果：✅ 成功\n");
+            }
+            else {
+                printf("HASH 测试结果：❌ 失败\n");
             }
             break;
         case 9: // HMAC
@@ -138,8 +151,53 @@ int main()
                 printf("HMAC 测试结果：❌ 失败\n");
             }
             break;
+        case 10: // KDF
+            printf("\n>>> 正在运行 KDF (PBKDF2 / HKDF) 测试...\n");
+            if (test_kdf_main() == 0) {
+                printf("KDF 测试结果：✅ 成功\n");
+            }
+            else {
+                printf("KDF 测试结果：❌ 失败\n");
+            }
+            break;
+        case 11: // NONCE
+            printf("\n>>> 正在运行 NONCE (签名随机数池) 测试...\n");
+            if (test_nonce_main() == 0) {
+                printf("NONCE 测试结果：✅ 成功\n");
+            }
+            else {
+                printf("NONCE 测试结果：❌ 失败\n");
+            }
+            break;
+        case 12: // ECC256
+            printf("\n>>> 正在运行 ECC256 (256 位椭圆曲线) 测试...\n");
+            if (test_ecc256_main() == 0) {
+                printf("ECC256 测试结果：✅ 成功\n");
+            }
+            else {
+                printf("ECC256 测试结果：❌ 失败\n");
+            }
+            break;
+        case 13: // X25519
+            printf("\n>>> 正在运行 X25519 (Curve25519 密钥交换) 测试...\n");
+            if (test_curve25519_main() == 0) {
+                printf("X25519 测试结果：✅ 成功\n");
+            }
+            else {
+                printf("X25519 测试结果：❌ 失败\n");
+            }
+            break;
+        case 14: // Ed25519
+            printf("\n>>> 正在运行 Ed25519 (Edwards 曲线签名) 测试...\n");
+            if (test_ed25519_main() == 0) {
+                printf("Ed25519 测试结果：✅ 成功\n");
+            }
+            else {
+                printf("Ed25519 测试结果：❌ 失败\n");
+            }
+            break;
         default:
-            printf("\n警告：输入的选项 %d 无效，请重新选择 (0-9)。\n", choice);
+            printf("\n警告：输入的选项 %d 无效，请重新选择 (0-14)。\n", choice);
             break;
         }
     }
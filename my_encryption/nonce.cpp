@@ -0,0 +1,174 @@
+#include "nonce.h"
+#include <stdio.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct NONCE_POOL {
+    NONCE_KIND kind;
+    uint64 p;             // DSA / ElGamal: ģ p
+    uint64 q;             // DSA: q;  ElGamal: p-1;  ECDSA: ߽ n ( k ȡֵΧģ)
+    uint64 g;             // DSA / ElGamal: Ԫ
+    ECC_Curve curve;      // ECDSA
+    ECC_Point G;          // ECDSA
+
+    std::mutex m;
+    std::condition_variable not_full;
+    std::deque<NONCE_TRIPLE> triples;
+    size_t depth;
+    bool stop;
+    uint64 pops;
+    uint64 empty;
+    uint64 produced;
+    std::vector<std::thread> workers;
+};
+
+// һԪ (̨߳ؿʱֳ㹲)
+static void nonce_generate(const NONCE_POOL* pool, NONCE_TRIPLE* out) {
+    for (;;) {
+        uint64 k = random_uint64() % (pool->q - 1) + 1; // 1 <= k < q
+        uint64 k_inv = mod_inverse(k, pool->q);
+        if (k_inv == 0) continue; // ElGamal: k  p-1 ʣѡ
+
+        uint64 r;
+        switch (pool->kind) {
+        case NONCE_DSA:
+            r = power_fixed_base(pool->g, k, pool->p) % pool->q;
+            break;
+        case NONCE_ELGAMAL:
+            r = power_fixed_base(pool->g, k, pool->p);
+            break;
+        default: {
+            ECC_Point R = ecc_scalar_mult_base(k, pool->G, pool->curve);
+            r = R.is_infinity ? 0 : R.x % pool->q;
+            break;
+        }
+        }
+        if (r == 0) continue; // r = 0  k ǩ
+
+        out->k = k;
+        out->r = r;
+        out->k_inv = k_inv;
+        return;
+    }
+}
+
+static void nonce_worker(NONCE_POOL* pool) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lk(pool->m);
+            pool->not_full.wait(lk, [pool] { return pool->stop || pool->triples.size() < pool->depth; });
+            if (pool->stop) return;
+        }
+
+        // 㣬߳̿ͬʱ
+        NONCE_TRIPLE t;
+        nonce_generate(pool, &t);
+
+        std::lock_guard<std::mutex> lk(pool->m);
+        if (pool->triples.size() < pool->depth) {
+            pool->triples.push_back(t);
+            pool->produced++;
+        }
+    }
+}
+
+static NONCE_POOL* nonce_pool_start(NONCE_POOL* pool, size_t depth, int num_threads) {
+    pool->depth = depth;
+    pool->stop = false;
+    pool->pops = 0;
+    pool->empty = 0;
+    pool->produced = 0;
+    if (num_threads < 1) num_threads = 1;
+    for (int i = 0; i < num_threads; i++) pool->workers.emplace_back(nonce_worker, pool);
+    return pool;
+}
+
+// 1.  / 
+NONCE_POOL* nonce_pool_create_dsa(const DSA_Params* params, size_t depth, int num_threads) {
+    if (params->q < 2) {
+        printf("Error: Invalid DSA parameters for nonce pool.\n");
+        return NULL;
+    }
+    NONCE_POOL* pool = new NONCE_POOL();
+    pool->kind = NONCE_DSA;
+    pool->p = params->p;
+    pool->q = params->q;
+    pool->g = params->g;
+    return nonce_pool_start(pool, depth, num_threads);
+}
+
+NONCE_POOL* nonce_pool_create_elgamal(uint64 p, uint64 g, size_t depth, int num_threads) {
+    if (p < 3) {
+        printf("Error: Invalid ElGamal modulus for nonce pool.\n");
+        return NULL;
+    }
+    NONCE_POOL* pool = new NONCE_POOL();
+    pool->kind = NONCE_ELGAMAL;
+    pool->p = p;
+    pool->q = p - 1;
+    pool->g = g;
+    return nonce_pool_start(pool, depth, num_threads);
+}
+
+NONCE_POOL* nonce_pool_create_ecdsa(const ECC_Curve* curve, ECC_Point G, size_t depth, int num_threads) {
+    if (curve->n < 2) {
+        printf("Error: Invalid curve order for nonce pool.\n");
+        return NULL;
+    }
+    NONCE_POOL* pool = new NONCE_POOL();
+    pool->kind = NONCE_ECDSA;
+    pool->q = curve->n;
+    pool->curve = *curve;
+    pool->G = G;
+    return nonce_pool_start(pool, depth, num_threads);
+}
+
+void nonce_pool_destroy(NONCE_POOL* pool) {
+    if (!pool) return;
+    {
+        std::lock_guard<std::mutex> lk(pool->m);
+        pool->stop = true;
+    }
+    pool->not_full.notify_all();
+    for (auto& t : pool->workers) t.join();
+    delete pool;
+}
+
+// 2. ʹ
+void nonce_pool_pop(NONCE_POOL* pool, NONCE_TRIPLE* out) {
+    {
+        std::lock_guard<std::mutex> lk(pool->m);
+        pool->pops++;
+        if (!pool->triples.empty()) {
+            *out = pool->triples.front();
+            pool->triples.pop_front();
+            pool->not_full.notify_one();
+            return;
+        }
+        pool->empty++;
+    }
+    // ѿ: ȴֱֳ̨̣߳
+    nonce_generate(pool, out);
+}
+
+void nonce_pool_set_depth(NONCE_POOL* pool, size_t depth) {
+    {
+        std::lock_guard<std::mutex> lk(pool->m);
+        pool->depth = depth;
+        // СʱԪ (δʹùǰȫ)
+        while (pool->triples.size() > depth) pool->triples.pop_back();
+    }
+    pool->not_full.notify_all();
+}
+
+void nonce_pool_get_stats(NONCE_POOL* pool, NONCE_POOL_STATS* stats) {
+    std::lock_guard<std::mutex> lk(pool->m);
+    stats->pops = pool->pops;
+    stats->empty = pool->empty;
+    stats->produced = pool->produced;
+    stats->available = pool->triples.size();
+    stats->depth = pool->depth;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef NONCE_H
+#define NONCE_H
+
+#include "utils.h"
+#include "dsa.h"
+#include "ecc.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// õǩ㷨
+typedef enum {
+    NONCE_DSA = 0,
+    NONCE_ELGAMAL = 1,
+    NONCE_ECDSA = 2
+} NONCE_KIND;
+
+// ͳ
+typedef struct {
+    uint64 pops;      // nonce_pool_pop ô
+    uint64 empty;     // ΪաֳֻĴ
+    uint64 produced;  // ̨߳ɵԪ
+    size_t available; // ǰпõԪ
+    size_t depth;     // ǰ趨ĳ
+} NONCE_POOL_STATS;
+
+//  (ڲṹⱩ¶)
+typedef struct NONCE_POOL NONCE_POOL;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // --- 1.  /  ---
+    // ̨߳ڳδʱ (k, r, k^(-1))ǩʱֻ赯һģ
+
+    /**
+     *  DSA 
+     * @param depth: ԤԪ
+     * @param num_threads: ̨߳ (>= 1)
+     */
+    NONCE_POOL* nonce_pool_create_dsa(const DSA_Params* params, size_t depth, int num_threads);
+
+    /**
+     *  ElGamal  (k  p-1 )
+     * @param p, g: 빫Կе p, g һ
+     */
+    NONCE_POOL* nonce_pool_create_elgamal(uint64 p, uint64 g, size_t depth, int num_threads);
+
+    /**
+     *  ECDSA 
+     * @param curve, G: ˽Կе߲Ԫһ
+     */
+    NONCE_POOL* nonce_pool_create_ecdsa(const ECC_Curve* curve, ECC_Point G, size_t depth, int num_threads);
+
+    // ֹ̨̲ͣ߳ͷų
+    void nonce_pool_destroy(NONCE_POOL* pool);
+
+    // --- 2. ʹ ---
+
+    /**
+     * ȡһԪ; Ϊʱֳ (ȴ) empty ͳ
+     * ÿԪֻᱻȡһ
+     */
+    void nonce_pool_pop(NONCE_POOL* pool, NONCE_TRIPLE* out);
+
+    // ; ̨߳
+    void nonce_pool_set_depth(NONCE_POOL* pool, size_t depth);
+
+    // ȡͳ
+    void nonce_pool_get_stats(NONCE_POOL* pool, NONCE_POOL_STATS* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NONCE_H
\ No newline at end of file
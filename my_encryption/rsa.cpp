@@ -1,5 +1,6 @@
 #include "rsa.h"
 #include <stdio.h>
+#include <string.h>
 
 
 // 1. RSA Կ (뱣ֲ䣬οһظ)
@@ -33,9 +34,92 @@ bool rsa_generate_keys(uint64 p, uint64 q, uint64 e, RSA_PublicKey* pub, RSA_Pri
     priv->n = n;
     priv->d = d;
 
+    // CRT 
+    priv->p = p;
+    priv->q = q;
+    priv->dP = d % (p - 1);
+    priv->dQ = d % (q - 1);
+    priv->qInv = mod_inverse(q % p, p);
+
     return true;
 }
 
+// 1b. Կ
+// q  p ͬʱ q 
+#define RSA_KEYGEN_RETRIES 8
+
+bool rsa_generate_keypair(int bits, uint64 e, RSA_PublicKey* pub, RSA_PrivateKey* priv, int num_threads) {
+    if (bits < 16 || bits > 62) {
+        printf(": ģλ %d ַ֧Χ (16 ~ 62)\n", bits);
+        return false;
+    }
+    if (e < 3 || (e & 1) == 0) {
+        printf(": Կָ e Ǵ 1 \n");
+        return false;
+    }
+
+    // λΪ 1˻ǡ bits λ
+    int p_bits = (bits + 1) / 2;
+    int q_bits = bits / 2;
+
+    // p >= 3 * 2^(p_bits - 2)q ͬɴ˵õ phi ½; e Сʱ e < phi ޷֤
+    uint64 phi_min = (((uint64)3 << (p_bits - 2)) - 1) * (((uint64)3 << (q_bits - 2)) - 1);
+    if (e >= phi_min) {
+        printf(": Կָ e  %d λģ (Ҫ e < %llu)\n", bits, phi_min);
+        return false;
+    }
+
+    uint64 p = generate_prime(p_bits, e, num_threads);
+    uint64 q = 0;
+    // pq λͬʱȡͬһ޴; generate_prime ʧʱ 0ֱӽ
+    for (int retry = 0; p != 0 && retry < RSA_KEYGEN_RETRIES; retry++) {
+        q = generate_prime(q_bits, e, num_threads);
+        if (q != p) break;
+    }
+
+    if (p == 0 || q == 0 || q == p) {
+        printf(": ʧܡ\n");
+        return false;
+    }
+    return rsa_generate_keys(p, q, e, pub, priv);
+}
+
+// CRT ΰ볤ģ: m1 = c^dP mod p, m2 = c^dQ mod q
+// ƽ-ͬһѭｻƽ
+// CPU ·˷/ȡģˮвִ (ָ)
+// ֳСģԱȿ̸߳
+static void crt_power_pair(uint64 c, const RSA_PrivateKey* priv, uint64* m1, uint64* m2) {
+    uint64 base1 = c % priv->p, base2 = c % priv->q;
+    uint64 e1 = priv->dP, e2 = priv->dQ;
+    uint64 r1 = 1, r2 = 1;
+
+    while (e1 > 0 || e2 > 0) {
+        if (e1 & 1) r1 = (r1 * base1) % priv->p;
+        if (e2 & 1) r2 = (r2 * base2) % priv->q;
+        e1 >>= 1;
+        e2 >>= 1;
+        base1 = (base1 * base1) % priv->p;
+        base2 = (base2 * base2) % priv->q;
+    }
+    *m1 = r1;
+    *m2 = r2;
+}
+
+// ˽Կ (ǩ):  CRTû CRT ʱ˻ c^d mod n
+static uint64 rsa_private_op(uint64 c, const RSA_PrivateKey* priv) {
+    if (priv->p == 0 || priv->q == 0) {
+        return power(c, priv->d, priv->n);
+    }
+
+    uint64 m1, m2;
+    crt_power_pair(c, priv, &m1, &m2);
+
+    // Garner ϲ: h = qInv * (m1 - m2) mod p, M = m2 + h * q
+    uint64 diff = (m1 + priv->p - (m2 % priv->p)) % priv->p;
+    uint64 h = (priv->qInv * diff) % priv->p;
+    return m2 + h * priv->q;
+}
+
 // 2. RSA  (Կ)
 uint64 rsa_encrypt(uint64 message, const RSA_PublicKey* pub) {
     return power(message, pub->e, pub->n);
@@ -43,7 +127,7 @@ uint64 rsa_encrypt(uint64 message, const RSA_PublicKey* pub) {
 
 // 3. RSA  (˽Կ)
 uint64 rsa_decrypt(uint64 ciphertext, const RSA_PrivateKey* priv) {
-    return power(ciphertext, priv->d, priv->n);
+    return rsa_private_op(ciphertext, priv);
 }
 
 // ==========================================
@@ -59,7 +143,7 @@ uint64 rsa_sign(uint64 message, const RSA_PrivateKey* priv) {
     }
     // ģʹ˽Կָ d ģ
     // S = M^d mod n
-    return power(message, priv->d, priv->n);
+    return rsa_private_op(message, priv);
 }
 
 // 5. RSA ǩ (Կ)
@@ -67,4 +151,293 @@ uint64 rsa_verify(uint64 signature, const RSA_PublicKey* pub) {
     // ģʹùԿָ e ģ
     // M' = S^e mod n
     return power(signature, pub->e, pub->n);
+}
+
+// ==========================================
+// --- ǩǩ ---
+// ==========================================
+
+bool rsa_batch_init(RSA_BATCH_CTX* ctx, const RSA_PrivateKey* priv) {
+    if (priv->p == 0 || priv->q == 0 || (priv->p & 1) == 0 || (priv->q & 1) == 0) {
+        printf(": ǩҪ CRT  p, q Ϊ˽Կ\n");
+        return false;
+    }
+
+    ctx->key = *priv;
+    mont_init(&ctx->mont_p, priv->p);
+    mont_init(&ctx->mont_q, priv->q);
+    ctx->qinv_mont = mont_to(priv->qInv, &ctx->mont_p);
+
+    uint64 max_e = (priv->dP > priv->dQ) ? priv->dP : priv->dQ;
+    ctx->window = mont_window_size(max_e);
+    ctx->win_p_len = mont_split_exponent(priv->dP, ctx->window, ctx->win_p);
+    ctx->win_q_len = mont_split_exponent(priv->dQ, ctx->window, ctx->win_q);
+    return true;
+}
+
+// ǩһ ( RSA_BATCH_INTERLEAVE ) Ϣ· 0 
+static void rsa_sign_group(const RSA_BATCH_CTX* ctx, const uint64* messages, uint64* signatures, size_t k) {
+    uint64 base[RSA_BATCH_INTERLEAVE] = { 0 };
+    uint64 m1[RSA_BATCH_INTERLEAVE], m2[RSA_BATCH_INTERLEAVE];
+    for (size_t j = 0; j < k; j++) base[j] = messages[j];
+
+    mont_power_x4(&ctx->mont_p, ctx->win_p, ctx->win_p_len, ctx->window, base, m1);
+    mont_power_x4(&ctx->mont_q, ctx->win_q, ctx->win_q_len, ctx->window, base, m2);
+
+    // Garner ϲ: h = qInv * (m1 - m2) mod p; qInv  Montgomery ʽֱӵõͨʽ
+    uint64 p = ctx->key.p;
+    for (size_t j = 0; j < k; j++) {
+        uint64 m2p = m2[j] % p;
+        uint64 diff = (m1[j] >= m2p) ? m1[j] - m2p : m1[j] + (p - m2p);
+        uint64 h = mont_mul(diff, ctx->qinv_mont, &ctx->mont_p);
+        signatures[j] = m2[j] + h * ctx->key.q;
+    }
+}
+
+typedef struct {
+    const RSA_BATCH_CTX* ctx;
+    const uint64* messages;
+    uint64* signatures;
+} RSA_SIGN_JOB;
+
+static void rsa_sign_range(size_t begin, size_t end, void* arg) {
+    const RSA_SIGN_JOB* job = (const RSA_SIGN_JOB*)arg;
+    for (size_t i = begin; i < end; i += RSA_BATCH_INTERLEAVE) {
+        size_t k = (end - i < RSA_BATCH_INTERLEAVE) ? end - i : RSA_BATCH_INTERLEAVE;
+        rsa_sign_group(job->ctx, job->messages + i, job->signatures + i, k);
+    }
+}
+
+void rsa_sign_batch(const RSA_BATCH_CTX* ctx, const uint64* messages, uint64* signatures, size_t count, int num_threads) {
+    RSA_SIGN_JOB job = { ctx, messages, signatures };
+    if (count < PARALLEL_MIN_ITEMS) num_threads = 1;
+    parallel_for(count, num_threads, rsa_sign_range, &job);
+}
+
+typedef struct {
+    const RSA_PublicKey* pub;
+    MONT_CTX mont;
+    const uint64* signatures;
+    const uint64* messages;
+    bool* ok;
+} RSA_VERIFY_JOB;
+
+// ֤һǩ: С e ʱָƽ4 ·չ
+static void rsa_verify_group(const RSA_VERIFY_JOB* job, size_t offset, size_t k) {
+    const MONT_CTX* mont = &job->mont;
+    uint64 e = job->pub->e;
+    uint64 s[RSA_BATCH_INTERLEAVE] = { 0 }, r[RSA_BATCH_INTERLEAVE];
+    for (size_t j = 0; j < k; j++) s[j] = mont_to(job->signatures[offset + j], mont);
+
+    if (e == 3) {
+        for (int j = 0; j < RSA_BATCH_INTERLEAVE; j++) r[j] = mont_mul(s[j], s[j], mont);
+        for (int j = 0; j < RSA_BATCH_INTERLEAVE; j++) r[j] = mont_mul(r[j], s[j], mont);
+    }
+    else if (e == 65537) {
+        // S^65537 = (S^(2^16)) * S: 16 ƽ + 1 γ˷
+        for (int j = 0; j < RSA_BATCH_INTERLEAVE; j++) r[j] = s[j];
+        for (int i = 0; i < 16; i++) {
+            for (int j = 0; j < RSA_BATCH_INTERLEAVE; j++) r[j] = mont_mul(r[j], r[j], mont);
+        }
+        for (int j = 0; j < RSA_BATCH_INTERLEAVE; j++) r[j] = mont_mul(r[j], s[j], mont);
+    }
+    else {
+        // ͨ·: Ӹλʼƽ-
+        int bits = 0;
+        while (e >> bits) bits++;
+        for (int j = 0; j < RSA_BATCH_INTERLEAVE; j++) r[j] = mont->one;
+        for (int i = bits - 1; i >= 0; i--) {
+            for (int j = 0; j < RSA_BATCH_INTERLEAVE; j++) r[j] = mont_mul(r[j], r[j], mont);
+            if ((e >> i) & 1) {
+                for (int j = 0; j < RSA_BATCH_INTERLEAVE; j++) r[j] = mont_mul(r[j], s[j], mont);
+            }
+        }
+    }
+
+    for (size_t j = 0; j < k; j++) {
+        job->ok[offset + j] = (mont_from(r[j], mont) == job->messages[offset + j]);
+    }
+}
+
+static void rsa_verify_range(size_t begin, size_t end, void* arg) {
+    const RSA_VERIFY_JOB* job = (const RSA_VERIFY_JOB*)arg;
+    for (size_t i = begin; i < end; i += RSA_BATCH_INTERLEAVE) {
+        size_t k = (end - i < RSA_BATCH_INTERLEAVE) ? end - i : RSA_BATCH_INTERLEAVE;
+        rsa_verify_group(job, i, k);
+    }
+}
+
+size_t rsa_verify_batch(const RSA_PublicKey* pub, const uint64* signatures, const uint64* messages,
+                        bool* results, size_t count, int num_threads) {
+    if (count == 0) return 0;
+
+    bool* ok = results ? results : new bool[count];
+    size_t valid = 0;
+
+    if ((pub->n & 1) == 0) {
+        // żģ޷ʹ Montgomery˻ͨǩ
+        for (size_t i = 0; i < count; i++) ok[i] = (rsa_verify(signatures[i], pub) == messages[i]);
+    }
+    else {
+        RSA_VERIFY_JOB job;
+        job.pub = pub;
+        mont_init(&job.mont, pub->n);
+        job.signatures = signatures;
+        job.messages = messages;
+        job.ok = ok;
+        if (count < PARALLEL_MIN_ITEMS) num_threads = 1;
+        parallel_for(count, num_threads, rsa_verify_range, &job);
+    }
+
+    for (size_t i = 0; i < count; i++) valid += ok[i] ? 1 : 0;
+    if (!results) delete[] ok;
+    return valid;
+}
+
+// ==========================================
+// --- OAEP / PSS  ---
+// ==========================================
+
+// 9. MGF1: mask = Hash(seed || 0) || Hash(seed || 1) || ...
+void mgf1_sha256_xor(const uint8* seed, size_t seed_len, uint8* out, size_t out_len) {
+    uint8 block[RSA_PAD_HASH_LEN];
+    uint32 counter = 0;
+    for (size_t off = 0; off < out_len; off += RSA_PAD_HASH_LEN, counter++) {
+        uint8 c[4] = { (uint8)(counter >> 24), (uint8)(counter >> 16), (uint8)(counter >> 8), (uint8)counter };
+        SHA256_CTX ctx;
+        sha256_init(&ctx);
+        sha256_update(&ctx, seed, seed_len);
+        sha256_update(&ctx, c, 4);
+        sha256_final(&ctx, block);
+
+        size_t n = (out_len - off < RSA_PAD_HASH_LEN) ? out_len - off : RSA_PAD_HASH_LEN;
+        for (size_t i = 0; i < n; i++) out[off + i] ^= block[i];
+    }
+}
+
+// 10. OAEP 
+bool rsa_oaep_encode(const uint8* msg, size_t msg_len, const uint8* label, size_t label_len,
+                     const uint8 seed[RSA_PAD_HASH_LEN], uint8* em, size_t k) {
+    const size_t h = RSA_PAD_HASH_LEN;
+    if (k < 2 * h + 2 || msg_len > k - 2 * h - 2) return false;
+
+    // em : [0] 0x00 | [1, 1+h) seed | [1+h, k) DB = lHash || PS || 0x01 || M
+    uint8* masked_seed = em + 1;
+    uint8* db = em + 1 + h;
+    size_t db_len = k - h - 1;
+
+    em[0] = 0x00;
+    SHA256_CTX ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, label, label_len);
+    sha256_final(&ctx, db);
+    memset(db + h, 0, db_len - h - msg_len - 1);
+    db[db_len - msg_len - 1] = 0x01;
+    if (msg_len > 0) memcpy(db + db_len - msg_len, msg, msg_len);
+
+    memcpy(masked_seed, seed, h);
+    mgf1_sha256_xor(masked_seed, h, db, db_len);   // maskedDB = DB ^ MGF(seed)
+    mgf1_sha256_xor(db, db_len, masked_seed, h);   // maskedSeed = seed ^ MGF(maskedDB)
+    return true;
+}
+
+// 11. OAEP : иʽ鶼ۻ bad ͳһжϣǰ
+bool rsa_oaep_decode(uint8* em, size_t k, const uint8* label, size_t label_len, uint8* msg, size_t* msg_len) {
+    const size_t h = RSA_PAD_HASH_LEN;
+    if (k < 2 * h + 2) return false;
+
+    uint8* seed = em + 1;
+    uint8* db = em + 1 + h;
+    size_t db_len = k - h - 1;
+
+    mgf1_sha256_xor(db, db_len, seed, h);
+    mgf1_sha256_xor(seed, h, db, db_len);
+
+    uint8 lhash[RSA_PAD_HASH_LEN];
+    SHA256_CTX ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, label, label_len);
+    sha256_final(&ctx, lhash);
+
+    uint8 bad = em[0];
+    bad |= constant_time_equal(db, lhash, h) ? 0 : 1;
+
+    // ҵ PS ֮ 0x01: ȫֽڣλòͬǰ
+    size_t one_index = 0;
+    uint8 found = 0;
+    for (size_t i = h; i < db_len; i++) {
+        // 0/1 ־õ (x - 1 Ľλ)one_index ѡ£ѭڲĵķ֧
+        uint8 is_one = (uint8)(((uint32)(db[i] ^ 0x01) - 1) >> 31);
+        uint8 is_zero = (uint8)(((uint32)db[i] - 1) >> 31);
+        size_t m = (size_t)0 - (size_t)(is_one & (found ^ 1));
+        one_index = (one_index & ~m) | (i & m);
+        bad |= (uint8)((found | is_one | is_zero) ^ 1);
+        found |= is_one;
+    }
+    bad |= (uint8)!found;
+
+    size_t len = db_len - one_index - 1;
+    if (bad || len > *msg_len) return false;
+    memcpy(msg, db + one_index + 1, len);
+    *msg_len = len;
+    return true;
+}
+
+// PSS: H = Hash(0x00 * 8 || mHash || salt)
+static void pss_hash(const uint8* mhash, const uint8* salt, size_t salt_len, uint8 out[RSA_PAD_HASH_LEN]) {
+    static const uint8 zeros[8] = { 0 };
+    SHA256_CTX ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, zeros, 8);
+    sha256_update(&ctx, mhash, RSA_PAD_HASH_LEN);
+    sha256_update(&ctx, salt, salt_len);
+    sha256_final(&ctx, out);
+}
+
+// 12. PSS 
+bool rsa_pss_encode(const uint8 mhash[RSA_PAD_HASH_LEN], const uint8* salt, size_t salt_len,
+                    size_t em_bits, uint8* em) {
+    const size_t h = RSA_PAD_HASH_LEN;
+    size_t em_len = (em_bits + 7) / 8;
+    if (em_len < h + salt_len + 2) return false;
+
+    // em : [0, db_len) DB = PS || 0x01 || salt | [db_len, db_len+h) H | 0xbc
+    size_t db_len = em_len - h - 1;
+    uint8* db = em;
+    uint8* hash = em + db_len;
+
+    pss_hash(mhash, salt, salt_len, hash);
+    memset(db, 0, db_len - salt_len - 1);
+    db[db_len - salt_len - 1] = 0x01;
+    if (salt_len > 0) memcpy(db + db_len - salt_len, salt, salt_len);
+    mgf1_sha256_xor(hash, h, db, db_len);
+
+    db[0] &= (uint8)(0xFF >> (8 * em_len - em_bits)); //  8*emLen - emBits λ
+    em[em_len - 1] = 0xbc;
+    return true;
+}
+
+// 13. PSS У
+bool rsa_pss_verify(const uint8 mhash[RSA_PAD_HASH_LEN], uint8* em, size_t em_bits, size_t salt_len) {
+    const size_t h = RSA_PAD_HASH_LEN;
+    size_t em_len = (em_bits + 7) / 8;
+    if (em_len < h + salt_len + 2 || em[em_len - 1] != 0xbc) return false;
+
+    size_t db_len = em_len - h - 1;
+    uint8* db = em;
+    const uint8* hash = em + db_len;
+    uint8 top_mask = (uint8)(0xFF >> (8 * em_len - em_bits));
+    if (db[0] & ~top_mask) return false;
+
+    mgf1_sha256_xor(hash, h, db, db_len);
+    db[0] &= top_mask;
+
+    for (size_t i = 0; i < db_len - salt_len - 1; i++) {
+        if (db[i] != 0x00) return false;
+    }
+    if (db[db_len - salt_len - 1] != 0x01) return false;
+
+    uint8 expected[RSA_PAD_HASH_LEN];
+    pss_hash(mhash, db + db_len - salt_len, salt_len, expected);
+    return constant_time_equal(expected, hash, h);
 }
\ No newline at end of file
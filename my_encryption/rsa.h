@@ -2,6 +2,7 @@
 #define RSA_H
 
 #include "utils.h"
+#include "hash.h" // OAEP / PSS ʹ SHA-256
 #include <stdint.h>
 
 // RSA Կṹ
@@ -11,11 +12,38 @@ typedef struct {
 } RSA_PublicKey;
 
 // RSA ˽Կṹ
+//  (d, n) ⻹ CRT  / ǩΪΰ볤ģ + Garner ϲ
+// ֻ (d, n) ˽Կ (p = q = 0) ԰ M = C^d mod n 
 typedef struct {
-    uint64 d; // ˽Կָ
-    uint64 n; // ģ
+    uint64 d;    // ˽Կָ
+    uint64 n;    // ģ
+    uint64 p;    //  p
+    uint64 q;    //  q
+    uint64 dP;   // d mod (p-1)
+    uint64 dQ;   // d mod (q-1)
+    uint64 qInv; // q^(-1) mod p
 } RSA_PrivateKey;
 
+// OAEP / PSS ʹõĹϣ (SHA-256)
+#define RSA_PAD_HASH_LEN SHA256_BLOCK_SIZE
+
+// ǩһνƽϢ (4  Montgomery ˷)
+#define RSA_BATCH_INTERLEAVE MONT_INTERLEAVE
+
+// ǩ: ͬһ˽ԿǩϢʱϢ޹صĲȫԤ
+// (p/q  Montgomery dP/dQ Ĺ̶ڷֽ⡢Montgomery ʽ qInv)
+typedef struct {
+    RSA_PrivateKey key;
+    MONT_CTX mont_p;     // ģ p  Montgomery 
+    MONT_CTX mont_q;     // ģ q  Montgomery 
+    uint64 qinv_mont;    // qInv  Montgomery ʽ (Garner ϲʱʡȥһȡģ)
+    int window;          // ڿ (λ)ָѡȡ
+    int win_p_len;       // dP Ĵڸ
+    int win_q_len;       // dQ Ĵڸ
+    uint8 win_p[64];     // dP ڲֺĸλ (λǰ)
+    uint8 win_q[64];     // dQ ڲֺĸλ (λǰ)
+} RSA_BATCH_CTX;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -23,8 +51,19 @@ extern "C" {
     // --- Կ ---
     bool rsa_generate_keys(uint64 p, uint64 q, uint64 e, RSA_PublicKey* pub, RSA_PrivateKey* priv);
 
+    /**
+     * ָλԿ
+     * p, q  generate_prime õ (֤ gcd(e, p-1) = gcd(e, q-1) = 1)ģ n ǡ bits λ
+     * @param bits: ģλ16 ~ 62 (n  phi ҪŽ 64 λз)
+     * @param e:  1 СڰλȡС phi (e = 65537 ʱ bits Ϊ 17)
+     * @return: ʧʱ false
+     * @param num_threads: ߳; <= 0 ʾʹȫ
+     */
+    bool rsa_generate_keypair(int bits, uint64 e, RSA_PublicKey* pub, RSA_PrivateKey* priv, int num_threads);
+
     // --- / (ͨ) ---
     uint64 rsa_encrypt(uint64 message, const RSA_PublicKey* pub);
+    // ʹ CRT: m1 = C^dP mod p, m2 = C^dQ mod q, M = m2 + q * (qInv * (m1 - m2) mod p)
     uint64 rsa_decrypt(uint64 ciphertext, const RSA_PrivateKey* priv);
 
     // --- ǩ/ǩ (֤) ---
@@ -32,7 +71,7 @@ extern "C" {
     /**
      * 4. RSA ǩ (Sign)
      * ʹá˽ԿϢм㣬ǩ
-     * ʽ: S = M^d mod n
+     * ʽ: S = M^d mod n (ͬʹ CRT )
      */
     uint64 rsa_sign(uint64 message, const RSA_PrivateKey* priv);
 
@@ -43,6 +82,75 @@ extern "C" {
      */
     uint64 rsa_verify(uint64 signature, const RSA_PublicKey* pub);
 
+    // --- ǩ/ǩ (ͬһԿϢ) ---
+
+    /**
+     * 6. ʼǩ
+     * @param priv:  CRT  ( rsa_generate_keys )
+     * @return: ˽Կȱ CRT  p/q ʱ false
+     */
+    bool rsa_batch_init(RSA_BATCH_CTX* ctx, const RSA_PrivateKey* priv);
+
+    /**
+     * 7. ǩ
+     * ÿ RSA_BATCH_INTERLEAVE Ϣ㣬ϴʱָ̳߳
+     *  rsa_sign ȫͬ
+     * @param messages / signatures: count ϢӦǩ
+     * @param num_threads: ʹõ߳; <= 0 ʾʹȫ
+     */
+    void rsa_sign_batch(const RSA_BATCH_CTX* ctx, const uint64* messages, uint64* signatures, size_t count, int num_threads);
+
+    /**
+     * 8. ǩ
+     *  S^e mod n == M; e = 3  e = 65537 רչĿ·
+     * @param results: ÿǩ֤ (Ϊ NULL)
+     * @return: ֤ͨǩ
+     */
+    size_t rsa_verify_batch(const RSA_PublicKey* pub, const uint64* signatures, const uint64* messages,
+                            bool* results, size_t count, int num_threads);
+
+    // --- OAEP / PSS  (RFC 8017, ϣ MGF1 Ϊ SHA-256) ---
+    //  EM д÷ṩĻ̲κζѷ䡣
+    // ע:  RSA ģ 64 λ (8 ֽ) OAEP Ҫ 66 ֽڡPSS  66 ֽڵģ
+    // ֻṩ㣬EM 轻ֶ֧ӦλĴ RSA 㡣
+
+    /**
+     * 9. MGF1-SHA256 ɣֱ out (ԭأҪʱ)
+     */
+    void mgf1_sha256_xor(const uint8* seed, size_t seed_len, uint8* out, size_t out_len);
+
+    /**
+     * 10. OAEP : EM = 0x00 || maskedSeed || maskedDB
+     * @param seed: 32 ֽ (ɵ÷ṩڸֲ)
+     * @param em:  k (ģֽ)
+     * @return: Ϣ (msg_len > k - 2 * 32 - 2) ʱ false
+     */
+    bool rsa_oaep_encode(const uint8* msg, size_t msg_len, const uint8* label, size_t label_len,
+                         const uint8 seed[RSA_PAD_HASH_LEN], uint8* em, size_t k);
+
+    /**
+     * 11. OAEP 
+     * @param em:  k ıϢʱԭȥ (ݻᱻ޸)
+     * @param msg / msg_len: ; ɹʱ *msg_len ΪϢ
+     * @return: ʽ򻺳ʱ false (־ԭ)
+     */
+    bool rsa_oaep_decode(uint8* em, size_t k, const uint8* label, size_t label_len, uint8* msg, size_t* msg_len);
+
+    /**
+     * 12. PSS : EM = maskedDB || H || 0xbc
+     * @param mhash: Ϣ SHA-256 ժҪ
+     * @param em_bits: λ (ͨΪģλ - 1)em Ϊ ceil(em_bits / 8)
+     */
+    bool rsa_pss_encode(const uint8 mhash[RSA_PAD_HASH_LEN], const uint8* salt, size_t salt_len,
+                        size_t em_bits, uint8* em);
+
+    /**
+     * 13. PSS У
+     * @param em: ϢУʱԭȥ (ݻᱻ޸)
+     * @param salt_len: Լγ
+     */
+    bool rsa_pss_verify(const uint8 mhash[RSA_PAD_HASH_LEN], uint8* em, size_t em_bits, size_t salt_len);
+
 #ifdef __cplusplus
 }
 #endif
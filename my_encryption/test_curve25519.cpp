@@ -0,0 +1,261 @@
+#include "curve25519.h"
+#include "dh.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static bool bytes_equal_hex(const uint8* a, const char* hex) {
+    uint8 b[X25519_KEY_SIZE];
+    hex_to_bytes(hex, b, X25519_KEY_SIZE);
+    return memcmp(a, b, X25519_KEY_SIZE) == 0;
+}
+
+static uint64 rng_state = 0x2545F4914F6CDD1DULL;
+
+// 1. : 桢ȫԼ
+bool test_fe25519() {
+    printf("[ A] GF(2^255 - 19) :\n");
+    uint8 buf[32], out[32];
+    FE25519 a, b, c, one;
+    fe25519_one(&one);
+    for (int i = 0; i < 200; i++) {
+        seeded_random_bytes(&rng_state, buf, 32);
+        fe25519_from_bytes(&a, buf);
+        fe25519_inv(&b, &a);
+        fe25519_mul(&c, &a, &b);
+        fe25519_to_bytes(out, &c);
+        if (!bytes_equal_hex(out, "0100000000000000000000000000000000000000000000000000000000000000")) {
+            printf("    ?  %d  a * a^(-1) != 1\n", i);
+            return false;
+        }
+        // (a + b)^2 = a^2 + 2ab + b^2
+        FE25519 s, l, r, t;
+        fe25519_add(&s, &a, &b);
+        fe25519_sqr(&l, &s);
+        fe25519_sqr(&r, &a);
+        fe25519_sqr(&t, &b);
+        fe25519_add(&r, &r, &t);
+        fe25519_mul(&t, &a, &b);
+        fe25519_mul_small(&t, &t, 2);
+        fe25519_add(&r, &r, &t);
+        fe25519_sub(&l, &l, &r);
+        fe25519_to_bytes(out, &l);
+        for (int j = 0; j < 32; j++) {
+            if (out[j] != 0) {
+                printf("    ?  %d ƽչ\n", i);
+                return false;
+            }
+        }
+    }
+
+    // pp + 12^255 - 1 (ǹ淶) ȫԼ
+    const char* inputs[3] = {
+        "edffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+        "eeffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+        "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+    };
+    const char* expect[3] = {
+        "0000000000000000000000000000000000000000000000000000000000000000",
+        "0100000000000000000000000000000000000000000000000000000000000000",
+        "1200000000000000000000000000000000000000000000000000000000000000",
+    };
+    for (int i = 0; i < 3; i++) {
+        hex_to_bytes(inputs[i], buf, 32);
+        fe25519_from_bytes(&a, buf);
+        fe25519_mul(&a, &a, &one);
+        fe25519_to_bytes(out, &a);
+        if (!bytes_equal_hex(out, expect[i])) {
+            printf("    ? ǹ淶 %d Լ\n", i);
+            return false;
+        }
+    }
+    printf("    ? 200  / ƽչp ȫԼȷ\n");
+    return true;
+}
+
+// 2. RFC 7748  (5.2 ڵμ㣬6.1 Կ)
+bool test_x25519_vectors() {
+    printf("\n[ B] RFC 7748 :\n");
+    const char* cases[2][3] = {
+        { "a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4",
+          "e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c",
+          "c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552" },
+        { "4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d",
+          "e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493",
+          "95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957" },
+    };
+    uint8 k[32], u[32], out[32];
+    for (int i = 0; i < 2; i++) {
+        hex_to_bytes(cases[i][0], k, 32);
+        hex_to_bytes(cases[i][1], u, 32);
+        if (!x25519(out, k, u) || !bytes_equal_hex(out, cases[i][2])) {
+            printf("    ?  %d \n", i + 1);
+            print_hex("      õ", out, X25519_KEY_SIZE);
+            return false;
+        }
+    }
+
+    // : k, u <- X25519(k, u), k
+    memset(k, 0, 32);
+    k[0] = 9;
+    memcpy(u, k, 32);
+    for (int i = 1; i <= 1000; i++) {
+        x25519(out, k, u);
+        memcpy(u, k, 32);
+        memcpy(k, out, 32);
+        if (i == 1 && !bytes_equal_hex(k, "422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079")) {
+            printf("    ?  1 ν\n");
+            return false;
+        }
+    }
+    if (!bytes_equal_hex(k, "684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51")) {
+        printf("    ?  1000 ν\n");
+        return false;
+    }
+
+    uint8 a_priv[32], b_priv[32], a_pub[32], b_pub[32], a_shared[32], b_shared[32];
+    hex_to_bytes("77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a", a_priv, 32);
+    hex_to_bytes("5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb", b_priv, 32);
+    x25519_public_key(a_pub, a_priv);
+    x25519_public_key(b_pub, b_priv);
+    x25519(a_shared, a_priv, b_pub);
+    x25519(b_shared, b_priv, a_pub);
+    if (!bytes_equal_hex(a_pub, "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a") ||
+        !bytes_equal_hex(b_pub, "de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f") ||
+        !bytes_equal_hex(a_shared, "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742") ||
+        memcmp(a_shared, b_shared, 32) != 0) {
+        printf("    ? Alice / Bob Կ\n");
+        return false;
+    }
+
+    // С׵ u = 0 / u = 1 õȫ 0 ܣӦ false
+    memset(u, 0, 32);
+    bool low0 = x25519(out, a_priv, u);
+    u[0] = 1;
+    bool low1 = x25519(out, a_priv, u);
+    if (low0 || low1) {
+        printf("    ? С׵δܾ\n");
+        return false;
+    }
+    printf("    ? 鵥 1 / 1000 ΡAlice / Bob С׵ܾȷ\n");
+    return true;
+}
+
+// 3. ӿһ
+bool test_x25519_batch() {
+    printf("\n[ C]  X25519:\n");
+    const size_t N = 200;
+    uint8* scalars = new uint8[N * 32];
+    uint8* us = new uint8[N * 32];
+    uint8* out = new uint8[N * 32];
+    bool* ok = new bool[N];
+    bool passed = true;
+
+    seeded_random_bytes(&rng_state, scalars, N * 32);
+    size_t pubs = x25519_batch(us, scalars, NULL, ok, N, 0);
+    for (size_t i = 0; i < N && passed; i++) {
+        uint8 expect[32];
+        x25519_public_key(expect, scalars + i * 32);
+        passed = ok[i] && memcmp(expect, us + i * 32, 32) == 0;
+    }
+    if (!passed || pubs != N) {
+        printf("    ? ɹԿ㲻һ\n");
+    }
+
+    if (passed) {
+        seeded_random_bytes(&rng_state, scalars, N * 32);
+        memset(us + 5 * 32, 0, 32);     // С׵
+        size_t valid = x25519_batch(out, scalars, us, ok, N, 0);
+        for (size_t i = 0; i < N && passed; i++) {
+            uint8 expect[32];
+            bool e = x25519(expect, scalars + i * 32, us + i * 32);
+            passed = ok[i] == e && memcmp(expect, out + i * 32, 32) == 0;
+        }
+        if (!passed || valid != N - 1 || ok[5]) {
+            printf("    ? Э㲻һ\n");
+            passed = false;
+        }
+    }
+    if (passed) printf("    ? %zu ԿЭ ( 1 С׵) һ\n", N);
+
+    delete[] scalars;
+    delete[] us;
+    delete[] out;
+    delete[] ok;
+    return passed;
+}
+
+// 4. : X25519  DH ģգȽıʱ (ʱӦͬ)
+void bench_x25519() {
+    printf("\n[] X25519:\n");
+    const size_t N = 2000;
+    uint8* scalars = new uint8[N * 32];
+    uint8* us = new uint8[N * 32];
+    uint8* out = new uint8[N * 32];
+    seeded_random_bytes(&rng_state, scalars, N * 32);
+    x25519_batch(us, scalars, NULL, NULL, N, 0);
+    seeded_random_bytes(&rng_state, scalars, N * 32);
+
+    clock_t t0 = clock();
+    for (size_t i = 0; i < N; i++) x25519(out + i * 32, scalars + i * 32, us + i * 32);
+    double t_single = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    x25519_batch(out, scalars, us, NULL, N, 1);
+    double t_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    x25519_batch(out, scalars, us, NULL, N, 0);
+    double t_threads = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    if (t_single > 0) printf("    x25519:                 %.0f /\n", N / t_single);
+    if (t_batch > 0) printf("    x25519_batch:           %.0f / (̣߳ÿ 32 һ)\n", N / t_batch);
+    if (t_threads > 0) printf("    x25519_batch:           %.0f / (ȫģ CPU ʱ)\n", N / t_threads);
+
+    // ͬ DH (61 λģ) Э
+    DH_Context ctx;
+    ctx.p = 2305843009213693951ULL;
+    ctx.g = 3;
+    uint64* privs = new uint64[N];
+    uint64* pubs = new uint64[N];
+    uint64* secrets = new uint64[N];
+    for (size_t i = 0; i < N; i++) {
+        privs[i] = (i * 0x9E3779B97F4A7C15ULL) % (ctx.p - 2) + 1;
+        pubs[i] = (i * 0xC2B2AE3D27D4EB4FULL) % (ctx.p - 3) + 2;
+    }
+    uint64 acc = 0;
+    t0 = clock();
+    for (size_t i = 0; i < N; i++) acc += dh_compute_shared_secret(&ctx, privs[i], pubs[i]);
+    double t_dh = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    dh_compute_shared_secret_batch(&ctx, privs, pubs, secrets, NULL, N, 1);
+    double t_dh_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    if (t_dh > 0) printf("    DH (p = 2^61 - 1):      %.0f / [%llu]\n", N / t_dh, acc & 1);
+    if (t_dh_batch > 0) printf("    DH batch (߳):      %.0f / ( 61 λȫԣΪ)\n", N / t_dh_batch);
+
+    //  0x40..00  0x7f..f8 (üֱΪ 1  252)
+    uint8 k_low[32], k_high[32];
+    memset(k_low, 0, 32);
+    memset(k_high, 0xff, 32);
+    const int rounds = 500;
+    t0 = clock();
+    for (int i = 0; i < rounds; i++) x25519(out, k_low, us);
+    double t_low = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    for (int i = 0; i < rounds; i++) x25519(out, k_high, us);
+    double t_high = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    if (t_low > 0) printf("     1 / 252 ıʱ: %.3f\n", t_high / t_low);
+
+    delete[] scalars;
+    delete[] us;
+    delete[] out;
+    delete[] privs;
+    delete[] pubs;
+    delete[] secrets;
+}
+
+extern "C" int test_curve25519_main() {
+    printf("===========================================\n");
+    printf("       Curve25519 / X25519 \n");
+    printf("===========================================\n");
+    if (!test_fe25519() || !test_x25519_vectors() || !test_x25519_batch()) return 1;
+    bench_x25519();
+    return 0;
+}
\ No newline at end of file
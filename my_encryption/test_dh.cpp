@@ -1,5 +1,6 @@
 #include "dh.h"
 #include <stdio.h>
+#include <time.h>
 
 bool test_dh_exchange() {
     printf("===========================================\n");
@@ -58,9 +59,133 @@ bool test_dh_exchange() {
     }
 }
 
+// ̶:  power ȫһ ( 32 λģ)
+bool test_dh_fixed_base() {
+    printf("\n[̶] ͨģݶ:\n");
+    const uint64 params[][2] = { { 467, 2 }, { 2147483647ULL, 7 }, { 1000000007ULL, 5 }, { 18446744073709551557ULL, 2 } };
+    for (size_t i = 0; i < sizeof(params) / sizeof(params[0]); i++) {
+        DH_Context ctx;
+        ctx.p = params[i][0];
+        ctx.g = params[i][1];
+        uint64 e = 0x9E3779B97F4A7C15ULL;
+        for (int j = 0; j < 2000; j++) {
+            e = e * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint64 priv = (j < 3) ? (uint64)j : e % (ctx.p - 1);
+            if (j == 3) priv = ~(uint64)0; // ָռ 64 λ
+            if (power_fixed_base(ctx.g, priv, ctx.p) != power(ctx.g, priv, ctx.p)) {
+                printf("? һ: g=%llu, e=%llu, p=%llu\n", ctx.g, priv, ctx.p);
+                return false;
+            }
+        }
+        printf("    p=%llu, g=%llu: 2000 ָһ\n", ctx.p, ctx.g);
+    }
+
+    // : ͬһɴԿ
+    DH_Context ctx;
+    ctx.p = 2147483647ULL;
+    ctx.g = 7;
+    const int N = 1000000;
+    uint64 acc1 = 0, acc2 = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < N; i++) acc1 += power(ctx.g, (uint64)i * 2654435761u % (ctx.p - 2) + 1, ctx.p);
+    double t_plain = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    for (int i = 0; i < N; i++) acc2 += dh_generate_public_key(&ctx, (uint64)i * 2654435761u % (ctx.p - 2) + 1);
+    double t_table = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] %d  g^x mod p (p=%llu):\n", N, ctx.p);
+    if (t_plain > 0) printf("    power():            %.0f /\n", N / t_plain);
+    if (t_table > 0) printf("    ̶ (w=%d):   %.0f /\n", FIXED_BASE_WINDOW, N / t_table);
+    return acc1 == acc2;
+}
+
+// ԿЭ: Ϸ dh_compute_shared_secret һ£ǷӦ״̬
+bool test_dh_batch() {
+    printf("\n[Э] :\n");
+    const uint64 params[][2] = { { 467, 2 }, { 2147483647ULL, 7 }, { 2305843009213693951ULL, 3 } };
+    const size_t N = 1000;
+    uint64* privs = new uint64[N];
+    uint64* pubs = new uint64[N];
+    uint64* secrets = new uint64[N];
+    DH_STATUS* status = new DH_STATUS[N];
+    bool passed = true;
+
+    for (size_t t = 0; t < sizeof(params) / sizeof(params[0]) && passed; t++) {
+        DH_Context ctx;
+        ctx.p = params[t][0];
+        ctx.g = params[t][1];
+        uint64 seed = 99 + t;
+        for (size_t i = 0; i < N; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            privs[i] = (seed >> 11) % (ctx.p - 2) + 1;
+            pubs[i] = dh_generate_public_key(&ctx, (seed >> 3) % (ctx.p - 2) + 1);
+        }
+        // Ƿ
+        pubs[3] = 0;
+        pubs[4] = 1;
+        pubs[5] = ctx.p - 1;
+        pubs[6] = ctx.p + 5;
+        privs[7] = 0;
+
+        // С g^x Ҳ 1  p-1 ϣͬӦܾ
+        size_t expected_ok = 0;
+        for (size_t i = 0; i < N; i++) expected_ok += (pubs[i] >= 2 && pubs[i] <= ctx.p - 2 && privs[i] != 0) ? 1 : 0;
+
+        size_t ok = dh_compute_shared_secret_batch(&ctx, privs, pubs, secrets, status, N, 0);
+        if (ok != expected_ok || status[3] != DH_ERR_PUBLIC_KEY || status[4] != DH_ERR_PUBLIC_KEY ||
+            status[5] != DH_ERR_PUBLIC_KEY || status[6] != DH_ERR_PUBLIC_KEY || status[7] != DH_ERR_PRIVATE_KEY) {
+            printf("? Ƿ״̬ (p=%llu)\n", ctx.p);
+            passed = false;
+            break;
+        }
+        for (size_t i = 0; i < N; i++) {
+            if (status[i] != DH_OK) {
+                if (secrets[i] != 0) passed = false;
+                continue;
+            }
+            if (secrets[i] != dh_compute_shared_secret(&ctx, privs[i], pubs[i])) {
+                printf("?  %zu ܲһ (p=%llu)\n", i, ctx.p);
+                passed = false;
+                break;
+            }
+        }
+        if (passed) printf("    p=%llu: %zu ɹ%zu Ƿ뱻\n", ctx.p, ok, N - ok);
+    }
+
+    // : 61 λģ
+    if (passed) {
+        DH_Context ctx;
+        ctx.p = 2305843009213693951ULL;
+        ctx.g = 3;
+        for (size_t i = 0; i < N; i++) {
+            privs[i] = (i * 0x9E3779B97F4A7C15ULL) % (ctx.p - 2) + 1;
+            pubs[i] = (i * 0xC2B2AE3D27D4EB4FULL) % (ctx.p - 3) + 2;
+        }
+        uint64 acc = 0;
+        clock_t t0 = clock();
+        for (size_t i = 0; i < N; i++) acc += dh_compute_shared_secret(&ctx, privs[i], pubs[i]);
+        double t_single = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        t0 = clock();
+        dh_compute_shared_secret_batch(&ctx, privs, pubs, secrets, NULL, N, 1);
+        double t_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        for (size_t i = 0; i < N; i++) acc -= secrets[i];
+
+        printf("\n[] %zu Э (p=%llu):\n", N, ctx.p);
+        if (t_single > 0) printf("    dh_compute_shared_secret:       %.0f /\n", N / t_single);
+        if (t_batch > 0) printf("    dh_compute_shared_secret_batch: %.0f / (߳)\n", N / t_batch);
+        passed = (acc == 0);
+    }
+
+    delete[] privs;
+    delete[] pubs;
+    delete[] secrets;
+    delete[] status;
+    return passed;
+}
+
 // 
 extern "C" int test_dh_main() {
-    if (test_dh_exchange()) {
+    if (test_dh_exchange() && test_dh_fixed_base() && test_dh_batch()) {
         return 0;
     }
     return 1;
@@ -1,5 +1,7 @@
 #include "dsa.h"
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 bool test_dsa_full() {
     printf("===========================================\n");
@@ -70,9 +72,116 @@ bool test_dsa_full() {
     return true;
 }
 
+// 62 λ p / 32 λ q : ǩǩֿģݵľд
+bool test_dsa_large_params() {
+    printf("\n[] p Ϊ 62 λq Ϊ 32 λǩ/ǩ:\n");
+    const uint64 p = 2305843152558227287ULL;
+    const uint64 q = 4294967291ULL;
+    const uint64 g = 825429179120524832ULL;
+    DSA_PublicKey pub;
+    DSA_PrivateKey priv;
+    if (!dsa_generate_keys(p, q, g, 3141592653ULL, &pub, &priv)) return false;
+
+    const int N = 2000;
+    static uint64 digests[N];
+    static DSA_Signature sigs[N];
+    uint64 seed = 12345;
+    for (int i = 0; i < N; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        digests[i] = seed >> 16;
+        uint64 k = (seed >> 32) % (q - 1) + 1;
+        sigs[i] = dsa_sign(digests[i], k, &priv);
+        if (sigs[i].r == 0 || sigs[i].s == 0) return false;
+    }
+
+    for (int i = 0; i < N; i++) {
+        if (!dsa_verify(digests[i], sigs[i], &pub) || dsa_verify(digests[i] + 1, sigs[i], &pub)) {
+            printf("    ?  %d ǩ֤\n", i);
+            return false;
+        }
+    }
+    printf("    ? %d ǩȫͨ۸ժҪȫܾ\n", N);
+
+    // : д (ζģ) 뵱ǰ dsa_verify
+    int ok_old = 0, ok_new = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < N; i++) {
+        uint64 w = mod_inverse(sigs[i].s, q);
+        uint64 u1 = mul_mod(digests[i] % q, w, q), u2 = mul_mod(sigs[i].r, w, q);
+        uint64 v = mul_mod(power(g, u1, p), power(pub.y, u2, p), p) % q;
+        ok_old += (v == sigs[i].r);
+    }
+    double t_old = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    for (int i = 0; i < N; i++) ok_new += dsa_verify(digests[i], sigs[i], &pub);
+    double t_new = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    // ǩ: ۸ժҪԽǩ dsa_verify һ
+    static uint64 bad_digests[N];
+    static DSA_Signature bad_sigs[N];
+    static bool results[N];
+    for (int i = 0; i < N; i++) {
+        bad_digests[i] = digests[i] + (i % 7 == 3 ? 1 : 0);
+        bad_sigs[i] = sigs[i];
+        if (i % 11 == 5) bad_sigs[i].s = 0;
+        if (i % 13 == 6) bad_sigs[i].r = q;
+    }
+    size_t expected = 0;
+    for (int i = 0; i < N; i++) expected += dsa_verify(bad_digests[i], bad_sigs[i], &pub) ? 1 : 0;
+    DSA_BATCH_CTX ctx;
+    if (!dsa_batch_init(&ctx, &pub)) return false;
+    size_t got = dsa_verify_batch(&ctx, bad_digests, bad_sigs, results, N, 0);
+    for (int i = 0; i < N; i++) {
+        if (results[i] != dsa_verify(bad_digests[i], bad_sigs[i], &pub)) {
+            printf("    ? ǩ %d  dsa_verify һ\n", i);
+            return false;
+        }
+    }
+    if (got != expected || expected == 0 || expected == (size_t)N) return false;
+    printf("    ? ǩ: %zu / %d ͨ dsa_verify һ\n", got, N);
+
+    // ͬԿ: ÿ (ͬһ y )y 뵥ıһ£
+    // g ıȫֻеͬһ
+    const int KEYS = 40, PER_KEY = 16;
+    FIXED_BASE_TABLE* y_table = new FIXED_BASE_TABLE;
+    bool keys_ok = true;
+    for (int key = 0; key < KEYS && keys_ok; key++) {
+        DSA_PublicKey kpub;
+        DSA_PrivateKey kpriv;
+        DSA_BATCH_CTX kctx;
+        if (!dsa_generate_keys(p, q, g, 1000003ULL * (key + 1), &kpub, &kpriv) || !dsa_batch_init(&kctx, &kpub)) {
+            keys_ok = false;
+            break;
+        }
+        for (int i = 0; i < 2 * PER_KEY; i++) {
+            uint64 k = (digests[i] >> 7) % (q - 1) + 1;
+            bad_sigs[i] = dsa_sign(digests[i], k, &kpriv);
+        }
+        fixed_base_init(y_table, kpub.y, p);
+        keys_ok = dsa_verify_batch(&kctx, digests, bad_sigs, NULL, PER_KEY, 0) == (size_t)PER_KEY &&
+                  dsa_verify_batch(&kctx, digests + PER_KEY, bad_sigs + PER_KEY, NULL, PER_KEY, 0) == (size_t)PER_KEY &&
+                  memcmp(kctx.y_table.table, y_table->table, sizeof(y_table->table)) == 0 &&
+                  kctx.g_table == ctx.g_table;
+        if (!keys_ok) printf("    ?  %d Կǩʧ\n", key);
+    }
+    delete y_table;
+    if (!keys_ok) return false;
+    printf("    ? %d Կͬһǩ 2 x %d y 뵥һ\n", KEYS, PER_KEY);
+
+    t0 = clock();
+    size_t batch_ok = dsa_verify_batch(&ctx, digests, sigs, NULL, N, 1);
+    double t_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] %d ǩ:\n", N);
+    if (t_old > 0) printf("    ζģ:             %.0f /\n", N / t_old);
+    if (t_new > 0) printf("    dsa_verify (/Shamir): %.0f /\n", N / t_new);
+    if (t_batch > 0) printf("    dsa_verify_batch (߳): %.0f /\n", N / t_batch);
+    return ok_old == N && ok_new == N && batch_ok == (size_t)N;
+}
+
 // 
 extern "C" int test_dsa_main() {
-    if (test_dsa_full()) {
+    if (test_dsa_full() && test_dsa_large_params()) {
         return 0;
     }
     return 1;
@@ -1,5 +1,7 @@
 #include "ecc.h"
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 bool test_ecc_full() {
     printf("===========================================\n");
@@ -85,7 +87,656 @@ bool test_ecc_full() {
     return true;
 }
 
+// οʵ: ÿһ ecc_point_add (ÿһ)
+static ECC_Point affine_scalar_mult(uint64 k, ECC_Point P, ECC_Curve curve) {
+    ECC_Point R;
+    R.x = 0; R.y = 0; R.is_infinity = true;
+    while (k > 0) {
+        if (k & 1) R = ecc_point_add(R, P, curve);
+        P = ecc_point_add(P, P, curve);
+        k >>= 1;
+    }
+    return R;
+}
+
+static bool same_point(ECC_Point P, ECC_Point Q) {
+    if (P.is_infinity || Q.is_infinity) return P.is_infinity == Q.is_infinity;
+    return P.x == Q.x && P.y == Q.y;
+}
+
+bool test_ecc_jacobian() {
+    printf("\n[ C] ſɱ (ʵֶԱ):\n");
+
+    // 1. : 0 ~ 2n бεӵĽһ
+    ECC_Curve toy = { 17, 2, 2, 19 };
+    ECC_Point G = { 5, 1, false };
+    ECC_Point acc = { 0, 0, true };
+    for (uint64 k = 0; k <= 2 * toy.n; k++) {
+        if (!same_point(ecc_scalar_mult(k, G, toy), acc)) {
+            printf("    ?  k = %llu һ\n", k);
+            return false;
+        }
+        acc = ecc_point_add(acc, G, toy);
+    }
+    printf("    ?  k = 0..%llu ȫһ\n", 2 * toy.n);
+
+    // 2.  y^2 = x^3 + 2x + 3: 31 λ 61 λģ (м˻ 64 λ)
+    //    Լ p = 2^64 - 59a = p - 3 ߣp  a  2^63ģӱ
+    ECC_Curve curves[3] = {
+        { 2147483647ULL, 2, 3, 0 },
+        { 2305843009213693951ULL, 2, 3, 0 },
+        { 18446744073709551557ULL, 18446744073709551554ULL, 1633516122122270050ULL, 0 },
+    };
+    ECC_Point bases[3] = {
+        { 8, 1235397887ULL, false },
+        { 7, 940987931915529336ULL, false },
+        { 5, 1311768467463790321ULL, false },
+    };
+    const int curve_bits[3] = { 31, 61, 64 };
+    uint64 seed = 0x9E3779B97F4A7C15ULL;
+    for (int c = 0; c < 3; c++) {
+        ECC_Curve cv = curves[c];
+        ECC_Point B = bases[c];
+        for (int i = 0; i < 50; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint64 k1 = seed >> 4;
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint64 k2 = seed >> 4;
+
+            ECC_Point R1 = ecc_scalar_mult(k1, B, cv);
+            if (!same_point(R1, affine_scalar_mult(k1, B, cv)) || !ecc_is_on_curve(R1, cv)) {
+                printf("    ?  %d ˷һ (k = %llu)\n", c, k1);
+                return false;
+            }
+
+            // һ / ϵ /  ӶԱ
+            ECC_Point R2 = ecc_scalar_mult(k2, B, cv);
+            ECC_JacobianPoint J1 = ecc_jacobian_scalar_mult(k1, B, cv);
+            ECC_JacobianPoint J2 = ecc_jacobian_scalar_mult(k2, B, cv);
+            ECC_Point sum = ecc_point_add(R1, R2, cv);
+            if (!same_point(ecc_from_jacobian(ecc_jacobian_add(J1, J2, cv), cv), sum) ||
+                !same_point(ecc_from_jacobian(ecc_jacobian_add_affine(J1, R2, cv), cv), sum) ||
+                !same_point(ecc_from_jacobian(ecc_jacobian_double(J1, cv), cv), ecc_point_add(R1, R1, cv)) ||
+                !same_point(ecc_from_jacobian(ecc_jacobian_add(J1, J1, cv), cv), ecc_point_add(R1, R1, cv))) {
+                printf("    ?  %d ſɱȵӲһ\n", c);
+                return false;
+            }
+
+            // P + (-P) = O
+            ECC_Point neg = R1;
+            neg.y = cv.p - R1.y;
+            if (ecc_jacobian_add_affine(J1, neg, cv).Z != 0) {
+                printf("    ?  %d P + (-P) Զ\n", c);
+                return false;
+            }
+        }
+        printf("    ? %d λģ: 50 һ\n", curve_bits[c]);
+    }
+
+    // 3. ٶȶԱ: 61 λģϵı˷
+    const int rounds = 2000;
+    uint64 check = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < rounds; i++) check ^= affine_scalar_mult(0x1FFFFFFFFFFFFFFFULL - i, bases[1], curves[1]).x;
+    clock_t t1 = clock();
+    for (int i = 0; i < rounds; i++) check ^= ecc_scalar_mult(0x1FFFFFFFFFFFFFFFULL - i, bases[1], curves[1]).x;
+    clock_t t2 = clock();
+    double ta = (double)(t1 - t0) / CLOCKS_PER_SEC;
+    double tj = (double)(t2 - t1) / CLOCKS_PER_SEC;
+    printf("    [] %d  61 λ˷:  %.3f s, ſɱ %.3f s ( %.1fx) [%llu]\n",
+        rounds, ta, tj, tj > 0 ? ta / tj : 0.0, check & 1);
+    return true;
+}
+
+//  Double-and-Add (ſɱ)Ϊ wNAF ٶȻ׼
+static ECC_JacobianPoint binary_scalar_mult(uint64 k, ECC_Point P, ECC_Curve curve) {
+    ECC_JacobianPoint R = { 1, 1, 0 };
+    for (int i = 63; i >= 0; i--) {
+        R = ecc_jacobian_double(R, curve);
+        if ((k >> i) & 1) R = ecc_jacobian_add_affine(R, P, curve);
+    }
+    return R;
+}
+
+bool test_ecc_wnaf() {
+    printf("\n[ D] wNAF ˷:\n");
+
+    // 1. ر: ֵԭΧ
+    uint64 samples[] = { 0, 1, 2, 7, 0xFFULL, 0x8000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL,
+                         0x7FFFFFFFFFFFFFFFULL, 0x1FFFFFFFFFFFFFFFULL, 0xAAAAAAAAAAAAAAAAULL, 123456789ULL };
+    int digits[ECC_WNAF_MAX_DIGITS];
+    for (int w = 2; w <= ECC_WNAF_MAX_WINDOW; w++) {
+        for (size_t t = 0; t < sizeof(samples) / sizeof(samples[0]); t++) {
+            uint64 k = samples[t];
+            int len = ecc_wnaf_recode(k, w, digits);
+            uint64 value = 0; // ģ 2^64 ԭ
+            int last_nonzero = -w;
+            for (int i = 0; i < len; i++) {
+                int d = digits[i];
+                if (i < 64) value += (uint64)(int64)d << i;
+                if (d == 0) continue;
+                if ((d & 1) == 0 || d >= (1 << (w - 1)) || -d >= (1 << (w - 1)) || i - last_nonzero < w) {
+                    printf("    ? w = %d, k = %llu:  %d λ %d Ϸ\n", w, k, i, d);
+                    return false;
+                }
+                last_nonzero = i;
+            }
+            if (value != k || len > ECC_WNAF_MAX_DIGITS || (len > 0 && digits[len - 1] == 0)) {
+                printf("    ? w = %d, k = %llu: رȷ\n", w, k);
+                return false;
+            }
+        }
+    }
+    printf("    ? w = 2..%d رȷ\n", ECC_WNAF_MAX_WINDOW);
+
+    // 2. ڿȵı˷Ʒһ
+    ECC_Curve curves[3] = {
+        { 17, 2, 2, 19 },
+        { 2147483647ULL, 2, 3, 0 },
+        { 2305843009213693951ULL, 2, 3, 0 },
+    };
+    ECC_Point bases[3] = {
+        { 5, 1, false },
+        { 8, 1235397887ULL, false },
+        { 7, 940987931915529336ULL, false },
+    };
+    uint64 seed = 0x2545F4914F6CDD1DULL;
+    for (int c = 0; c < 3; c++) {
+        for (int i = 0; i < 40; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint64 k = (i < 20) ? (uint64)i : seed;
+            ECC_Point expect = ecc_from_jacobian(binary_scalar_mult(k, bases[c], curves[c]), curves[c]);
+            for (int w = 2; w <= ECC_WNAF_MAX_WINDOW; w++) {
+                ECC_Point got = ecc_from_jacobian(ecc_jacobian_scalar_mult_wnaf(k, bases[c], w, curves[c]), curves[c]);
+                if (!same_point(got, expect)) {
+                    printf("    ?  %d, w = %d, k = %llu һ\n", c, w, k);
+                    return false;
+                }
+            }
+        }
+    }
+    printf("    ? 3  x 5 ִڿȽһ\n");
+
+    // 3. ٶȶԱ: 64 λ
+    const int rounds = 5000;
+    uint64 check = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < rounds; i++) check ^= binary_scalar_mult(0xF123456789ABCDEFULL - i, bases[2], curves[2]).X;
+    clock_t t1 = clock();
+    for (int i = 0; i < rounds; i++) check ^= ecc_jacobian_scalar_mult(0xF123456789ABCDEFULL - i, bases[2], curves[2]).X;
+    clock_t t2 = clock();
+    double tb = (double)(t1 - t0) / CLOCKS_PER_SEC;
+    double tw = (double)(t2 - t1) / CLOCKS_PER_SEC;
+    printf("    [] %d  64 λ˷:  %.3f s, wNAF(w=%d) %.3f s ( %.2fx) [%llu]\n",
+        rounds, tb, ecc_wnaf_window(0xF123456789ABCDEFULL), tw, tw > 0 ? tb / tw : 0.0, check & 1);
+    return true;
+}
+
+bool test_ecc_fixed_base() {
+    printf("\n[ E] ̶ k*G:\n");
+
+    ECC_Curve curves[3] = {
+        { 17, 2, 2, 19 },
+        { 2147483647ULL, 2, 3, 0 },
+        { 2305843009213693951ULL, 2, 3, 0 },
+    };
+    ECC_Point bases[3] = {
+        { 5, 1, false },
+        { 8, 1235397887ULL, false },
+        { 7, 940987931915529336ULL, false },
+    };
+
+    // 1. ڿȵĲ wNAF һ
+    uint64 seed = 0xD1B54A32D192ED03ULL;
+    for (int w = ECC_FIXED_BASE_MIN_WINDOW; w <= ECC_FIXED_BASE_MAX_WINDOW; w++) {
+        for (int c = 0; c < 3; c++) {
+            ECC_FIXED_BASE_TABLE table;
+            if (!ecc_fixed_base_init(&table, bases[c], curves[c], w)) {
+                printf("    ? w = %d ʧ\n", w);
+                return false;
+            }
+            for (int i = 0; i < 30; i++) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                uint64 k = (i < 20) ? (uint64)i : (i == 20 ? 0xFFFFFFFFFFFFFFFFULL : seed);
+                ECC_Point got = ecc_from_jacobian(ecc_fixed_base_mult(&table, k), curves[c]);
+                if (!same_point(got, ecc_scalar_mult(k, bases[c], curves[c]))) {
+                    printf("    ?  %d, w = %d, k = %llu һ\n", c, w, k);
+                    ecc_fixed_base_free(&table);
+                    return false;
+                }
+            }
+            ecc_fixed_base_free(&table);
+        }
+    }
+    printf("    ? w = %d..%d  wNAF һ\n", ECC_FIXED_BASE_MIN_WINDOW, ECC_FIXED_BASE_MAX_WINDOW);
+
+    // 2. : ͬһͬһűڿȲͬıֱ𻺴
+    const ECC_FIXED_BASE_TABLE* t1 = ecc_fixed_base_get(bases[2], curves[2]);
+    const ECC_FIXED_BASE_TABLE* t2 = ecc_fixed_base_get(bases[2], curves[2]);
+    if (t1 == nullptr || t1 != t2 || ecc_fixed_base_set_window(0) || ecc_fixed_base_set_window(ECC_FIXED_BASE_MAX_WINDOW + 1)) {
+        printf("    ? Ϊȷ\n");
+        return false;
+    }
+    ecc_fixed_base_set_window(8);
+    const ECC_FIXED_BASE_TABLE* t8 = ecc_fixed_base_get(bases[2], curves[2]);
+    ecc_fixed_base_set_window(ECC_FIXED_BASE_DEFAULT_WINDOW);
+    if (t8 == nullptr || t8 == t1 || t8->w != 8 || ecc_fixed_base_get(bases[2], curves[2]) != t1) {
+        printf("    ? ͬڿȵĻ治ȷ\n");
+        return false;
+    }
+    printf("    ? ȷ\n");
+
+    // 3. ٶȶԱ (ͬڿȵڴ / ٶȨ)
+    const int rounds = 20000;
+    uint64 check = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < rounds; i++) check ^= ecc_jacobian_scalar_mult(0xF123456789ABCDEFULL - i, bases[2], curves[2]).X;
+    double tw = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    printf("    [] %d  64 λ k*G: wNAF %.3f s\n", rounds, tw);
+    for (int w = 2; w <= ECC_FIXED_BASE_MAX_WINDOW; w += 2) {
+        ECC_FIXED_BASE_TABLE table;
+        ecc_fixed_base_init(&table, bases[2], curves[2], w);
+        t0 = clock();
+        for (int i = 0; i < rounds; i++) check ^= ecc_fixed_base_mult(&table, 0xF123456789ABCDEFULL - i).X;
+        double tf = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("           w = %d (%6zu ֽ): %.3f s ( %.1fx)\n", w,
+            (size_t)table.rows * ((1 << w) - 1) * sizeof(ECC_Point), tf, tf > 0 ? tw / tf : 0.0);
+        ecc_fixed_base_free(&table);
+    }
+    printf("           [%llu]\n", check & 1);
+    return true;
+}
+
+// 61 λ: y^2 = x^3 - 3x + 111 (mod 2^61 - 1)Ⱥ n Ϊ
+static const ECC_Curve curve61 = { 2305843009213693951ULL, 2305843009213693948ULL, 111, 2305843010818082053ULL };
+static const ECC_Point G61 = { 1, 509478702933351334ULL, false };
+
+bool test_ecdsa_double_mult() {
+    printf("\n[ F] ECDSA ǩ: u1*G + u2*Q :\n");
+
+    // 1. ֱӵĽһ
+    ECC_Curve curves[2] = { { 17, 2, 2, 19 }, curve61 };
+    ECC_Point bases[2] = { { 5, 1, false }, G61 };
+    uint64 seed = 0x94D049BB133111EBULL;
+    for (int c = 0; c < 2; c++) {
+        ECC_Point Q = ecc_scalar_mult(7, bases[c], curves[c]);
+        for (int i = 0; i < 60; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint64 u1 = (i < 8) ? (uint64)(i & 3) : seed;
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint64 u2 = (i < 8) ? (uint64)(i >> 2) : seed;
+            ECC_Point expect = ecc_point_add(ecc_scalar_mult(u1, bases[c], curves[c]), ecc_scalar_mult(u2, Q, curves[c]), curves[c]);
+            ECC_Point joint = ecc_from_jacobian(ecc_jacobian_double_mult(u1, bases[c], u2, Q, curves[c]), curves[c]);
+            ECC_Point joint_base = ecc_from_jacobian(ecc_jacobian_double_mult_base(u1, bases[c], u2, Q, curves[c]), curves[c]);
+            if (!same_point(joint, expect) || !same_point(joint_base, expect)) {
+                printf("    ?  %d: u1 = %llu, u2 = %llu һ\n", c, u1, u2);
+                return false;
+            }
+        }
+    }
+    printf("    ? ֱһ\n");
+
+    // 2. 61 λϵǩ / ǩ
+    ECC_PublicKey pub;
+    ECC_PrivateKey priv;
+    if (!ecc_generate_keys(curve61, G61, 0x0123456789ABCDEFULL, &pub, &priv)) return false;
+    for (int i = 0; i < 50; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64 hash = seed >> 3;
+        uint64 k = (seed % (curve61.n - 1)) + 1;
+        ECC_Signature sig = ecdsa_sign(hash, k, &priv);
+        if (!ecdsa_verify(hash, sig, &pub) || ecdsa_verify(hash ^ 1, sig, &pub)) {
+            printf("    ? 61 λߵ %d ǩ / ǩȷ\n", i);
+            return false;
+        }
+    }
+    printf("    ? 61 λǩ / ǩ 50 ȷ\n");
+
+    // 3. ٶȶԱ
+    const int rounds = 5000;
+    uint64 check = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < rounds; i++) {
+        uint64 u1 = 0x1D2C3B4A59687766ULL + i, u2 = 0x1A2B3C4D5E6F7788ULL - i;
+        check ^= ecc_jacobian_add(ecc_jacobian_scalar_mult(u1, G61, curve61), ecc_jacobian_scalar_mult(u2, pub.Q, curve61), curve61).X;
+    }
+    clock_t t1 = clock();
+    for (int i = 0; i < rounds; i++) {
+        uint64 u1 = 0x1D2C3B4A59687766ULL + i, u2 = 0x1A2B3C4D5E6F7788ULL - i;
+        check ^= ecc_jacobian_double_mult(u1, G61, u2, pub.Q, curve61).X;
+    }
+    clock_t t2 = clock();
+    for (int i = 0; i < rounds; i++) {
+        uint64 u1 = 0x1D2C3B4A59687766ULL + i, u2 = 0x1A2B3C4D5E6F7788ULL - i;
+        check ^= ecc_jacobian_double_mult_base(u1, G61, u2, pub.Q, curve61).X;
+    }
+    clock_t t3 = clock();
+    double ts = (double)(t1 - t0) / CLOCKS_PER_SEC;
+    double tj = (double)(t2 - t1) / CLOCKS_PER_SEC;
+    double tb = (double)(t3 - t2) / CLOCKS_PER_SEC;
+    printf("    [] %d  u1*G + u2*Q: ֱ %.3f s,  %.3f s (%.2fx),  + G  %.3f s (%.2fx) [%llu]\n",
+        rounds, ts, tj, tj > 0 ? ts / tj : 0.0, tb, tb > 0 ? ts / tb : 0.0, check & 1);
+    return true;
+}
+
+bool test_ecdsa_verify_batch() {
+    printf("\n[ G] ECDSA ǩ:\n");
+
+    // 3  61 λ߹Կ + 1 ߹Կ (߲棬֤)
+    ECC_PublicKey keys[4];
+    ECC_PrivateKey privs[4];
+    uint64 ds[3] = { 0x0123456789ABCDEFULL, 0x1F2E3D4C5B6A7988ULL, 12345 };
+    for (int i = 0; i < 3; i++) ecc_generate_keys(curve61, G61, ds[i], &keys[i], &privs[i]);
+    ECC_Curve toy = { 17, 2, 2, 19 };
+    ECC_Point toy_G = { 5, 1, false };
+    ecc_generate_keys(toy, toy_G, 7, &keys[3], &privs[3]);
+
+    const size_t count = 400;
+    uint64* hashes = new uint64[count];
+    ECC_Signature* sigs = new ECC_Signature[count];
+    ECC_PublicKey* pubs = new ECC_PublicKey[count];
+    bool* expect = new bool[count];
+    bool* results = new bool[count];
+
+    uint64 seed = 0xBF58476D1CE4E5B9ULL;
+    for (size_t i = 0; i < count; i++) {
+        int key = (i % 50 == 49) ? 3 : (int)(i % 3);
+        uint64 n = keys[key].curve.n;
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        hashes[i] = seed >> 3;
+        uint64 k = ((seed >> 7) % (n - 1)) + 1;
+        if (key == 3 && ((hashes[i] + (ecc_scalar_mult(k, toy_G, toy).x % n) * 7) % n == 0)) hashes[i]++; //  s = 0
+        sigs[i] = ecdsa_sign(hashes[i], k, &privs[key]);
+        pubs[i] = keys[key];
+        expect[i] = true;
+
+        // ÿ 7 һ۸
+        switch (i % 7 == 3 ? (i / 7) % 5 : -1) {
+        case 0: hashes[i] ^= 1; expect[i] = false; break;
+        case 1: sigs[i].r = 0; expect[i] = false; break;
+        case 2: sigs[i].s = n; expect[i] = false; break;
+        case 3: pubs[i] = keys[(key + 1) % 3]; expect[i] = false; break;
+        case 4: sigs[i].s = (sigs[i].s == 1) ? 2 : sigs[i].s - 1; expect[i] = false; break;
+        default: break;
+        }
+    }
+
+    size_t expect_ok = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (ecdsa_verify(hashes[i], sigs[i], &pubs[i]) != expect[i]) {
+            printf("    ?  %zu ǩԤڲ\n", i);
+            return false;
+        }
+        expect_ok += expect[i] ? 1 : 0;
+    }
+
+    int thread_counts[3] = { 1, 4, 0 };
+    for (int t = 0; t < 3; t++) {
+        size_t ok = ecdsa_verify_batch(hashes, sigs, pubs, results, count, thread_counts[t]);
+        for (size_t i = 0; i < count; i++) {
+            if (results[i] != expect[i]) {
+                printf("    ? ߳ %d:  %zu ȷ\n", thread_counts[t], i);
+                return false;
+            }
+        }
+        if (ok != expect_ok || ecdsa_verify_batch(hashes, sigs, pubs, NULL, count, thread_counts[t]) != expect_ok) {
+            printf("    ? ߳ %d: ͨ %zu != %zu\n", thread_counts[t], ok, expect_ok);
+            return false;
+        }
+    }
+    printf("    ? %zu ǩ (%zu Ч) ǩһ\n", count, expect_ok);
+
+    // ٶȶԱ
+    clock_t t0 = clock();
+    size_t c1 = 0;
+    for (int r = 0; r < 10; r++)
+        for (size_t i = 0; i < count; i++) c1 += ecdsa_verify(hashes[i], sigs[i], &pubs[i]) ? 1 : 0;
+    clock_t t1 = clock();
+    size_t c2 = 0;
+    for (int r = 0; r < 10; r++) c2 += ecdsa_verify_batch(hashes, sigs, pubs, results, count, 0);
+    clock_t t2 = clock();
+    double ts = (double)(t1 - t0) / CLOCKS_PER_SEC;
+    double tb = (double)(t2 - t1) / CLOCKS_PER_SEC;
+    printf("    [] %zu ǩ:  %.3f s,  %.3f s ( %.2fx) [%zu]\n",
+        count * 10, ts, tb, tb > 0 ? ts / tb : 0.0, c1 - c2);
+
+    delete[] hashes;
+    delete[] sigs;
+    delete[] pubs;
+    delete[] expect;
+    delete[] results;
+    return true;
+}
+
+// ˷ӣΪ˷Ĳο
+static ECC_Point naive_msm(const uint64* scalars, const ECC_Point* points, size_t count, ECC_Curve curve) {
+    ECC_JacobianPoint R = { 1, 1, 0 };
+    for (size_t i = 0; i < count; i++) R = ecc_jacobian_add(R, ecc_jacobian_scalar_mult(scalars[i], points[i], curve), curve);
+    return ecc_from_jacobian(R, curve);
+}
+
+bool test_ecc_msm() {
+    printf("\n[ H] ˷ (Pippenger):\n");
+
+    const size_t max_count = 2000;
+    uint64* scalars = new uint64[max_count];
+    ECC_Point* points = new ECC_Point[max_count];
+    uint64 seed = 0x853C49E6748FEA9BULL;
+
+    // 1. ͬһ: Զ㡢ظ (Ͱڱ) 뻥Ϊ෴ĵ
+    ECC_Curve curves[2] = { { 17, 2, 2, 19 }, curve61 };
+    ECC_Point bases[2] = { { 5, 1, false }, G61 };
+    size_t sizes[6] = { 1, 2, 7, 64, 300, 1000 };
+    for (int c = 0; c < 2; c++) {
+        for (int t = 0; t < 6; t++) {
+            size_t count = sizes[t];
+            for (size_t i = 0; i < count; i++) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                scalars[i] = (i % 11 == 5) ? 0 : (i % 3 == 0 ? seed >> 40 : seed);
+                if (i % 13 == 7) { points[i].x = 0; points[i].y = 0; points[i].is_infinity = true; }
+                else if (i % 5 == 4) points[i] = points[i - 1];
+                else if (i % 9 == 8) { points[i] = points[i - 1]; if (!points[i].is_infinity) points[i].y = curves[c].p - points[i].y; }
+                else points[i] = ecc_scalar_mult((seed >> 20) % 1000 + 1, bases[c], curves[c]);
+            }
+            ECC_Point expect = naive_msm(scalars, points, count, curves[c]);
+            for (int threads = 1; threads <= 4; threads += 3) {
+                if (!same_point(ecc_multi_scalar_mult(scalars, points, count, curves[c], threads), expect)) {
+                    printf("    ?  %d, %zu , ߳ %d: һ\n", c, count, threads);
+                    return false;
+                }
+            }
+        }
+    }
+    printf("    ? 1 ~ 1000 һ\n");
+
+    // 2. ٶȶԱ
+    for (size_t i = 0; i < max_count; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        scalars[i] = seed;
+        points[i] = ecc_scalar_mult(seed >> 3, G61, curve61);
+    }
+    clock_t t0 = clock();
+    ECC_Point a = naive_msm(scalars, points, max_count, curve61);
+    clock_t t1 = clock();
+    ECC_Point b = ecc_multi_scalar_mult(scalars, points, max_count, curve61, 0);
+    clock_t t2 = clock();
+    double tn = (double)(t1 - t0) / CLOCKS_PER_SEC;
+    double tp = (double)(t2 - t1) / CLOCKS_PER_SEC;
+    printf("    [] %zu  64 λ:  %.3f s, Pippenger %.3f s ( %.1fx)\n",
+        max_count, tn, tp, tp > 0 ? tn / tp : 0.0);
+
+    delete[] scalars;
+    delete[] points;
+    if (!same_point(a, b)) {
+        printf("    ? ܲԽһ\n");
+        return false;
+    }
+    return true;
+}
+
+//  I: һ SEC1 
+bool test_ecc_encoding() {
+    printf("\n[ I] һ SEC1 :\n");
+    uint64 seed = 0xD1B54A32D192ED03ULL;
+
+    // 1. ģƽ:  p = 3 (mod 4)5 (mod 8)1 (mod 8) ·Ƕʣ뱻ܾ
+    const uint64 primes[5] = { 2147483647ULL, 2305843009213693951ULL, 1099511627917ULL, 998244353ULL,
+                               4611686018427388073ULL };
+    for (int t = 0; t < 5; t++) {
+        uint64 p = primes[t];
+        for (int i = 0; i < 200; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint64 x = seed % p, r = 0;
+            uint64 a = mul_mod(x, x, p);
+            if (!ecc_sqrt_mod(a, p, &r) || mul_mod(r, r, p) != a) {
+                printf("    ? p = %llu: %llu ƽ\n", p, a);
+                return false;
+            }
+            uint64 b = (seed >> 7) % p;
+            bool residue = b == 0 || power(b, (p - 1) >> 1, p) == 1;
+            if (ecc_sqrt_mod(b, p, &r) != residue) {
+                printf("    ? p = %llu: %llu Ķʣжϴ\n", p, b);
+                return false;
+            }
+        }
+    }
+    printf("    ? 5  (ƽ㷨)  200 ƽʣжȷ\n");
+
+    // 2. һ:  Z ſɱȵ (Զ)  ecc_from_jacobian һ
+    ECC_Curve curves[2] = { { 2147483647ULL, 2, 3, 0 }, curve61 };
+    ECC_Point bases[2] = { { 8, 1235397887ULL, false }, G61 };
+    const size_t N = 300;
+    ECC_JacobianPoint* jp = new ECC_JacobianPoint[N];
+    ECC_Point* affine = new ECC_Point[N];
+    uint8* buf = new uint8[N * ECC_POINT_MAX_ENCODED_SIZE];
+    bool passed = true;
+    for (int c = 0; c < 2 && passed; c++) {
+        ECC_Curve cv = curves[c];
+        uint64 p = cv.p;
+        for (size_t i = 0; i < N; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            if (i % 37 == 5) {
+                jp[i].X = 1; jp[i].Y = 1; jp[i].Z = 0;
+                continue;
+            }
+            ECC_Point P = ecc_scalar_mult(seed >> 5, bases[c], cv);
+            uint64 z = seed % (p - 1) + 1, z2 = mul_mod(z, z, p);
+            jp[i].X = mul_mod(P.x, z2, p);
+            jp[i].Y = mul_mod(P.y, mul_mod(z2, z, p), p);
+            jp[i].Z = z;
+        }
+        ecc_batch_normalize(jp, affine, N, cv);
+        for (size_t i = 0; i < N && passed; i++) {
+            passed = same_point(affine[i], ecc_from_jacobian(jp[i], cv));
+        }
+        if (!passed) {
+            printf("    ?  %d: һһ\n", c);
+            break;
+        }
+
+        // 3. : ַʽѹ / δѹ
+        for (int compressed = 0; compressed <= 1 && passed; compressed++) {
+            size_t size = ecc_point_encoded_size(cv, compressed != 0);
+            size_t total = ecc_point_encode_batch(jp, N, cv, compressed != 0, buf);
+            for (size_t i = 0; i < N && passed; i++) {
+                uint8 single[ECC_POINT_MAX_ENCODED_SIZE];
+                size_t len = ecc_point_encode(affine[i], cv, compressed != 0, single, sizeof(single));
+                ECC_Point Q1, Q2;
+                passed = total == N * size && len == (affine[i].is_infinity ? 1 : size) &&
+                         memcmp(single, buf + i * size, len) == 0 &&
+                         ecc_point_decode(single, len, cv, &Q1) && same_point(Q1, affine[i]) &&
+                         ecc_point_decode(buf + i * size, size, cv, &Q2) && same_point(Q2, affine[i]);
+            }
+            if (!passed) printf("    ?  %d: %sʧ\n", c, compressed ? "ѹ" : "δѹ");
+        }
+
+        // 4. Ƿ: ǩȲx >= p㲻ϡ
+        if (passed) {
+            ECC_Point P = affine[0], Q;
+            uint8 enc[ECC_POINT_MAX_ENCODED_SIZE];
+            size_t L = ecc_field_bytes(cv);
+            size_t len = ecc_point_encode(P, cv, false, enc, sizeof(enc));
+            enc[0] = 0x05;
+            bool bad_tag = ecc_point_decode(enc, len, cv, &Q);
+            enc[0] = ECC_POINT_UNCOMPRESSED;
+            bool bad_len = ecc_point_decode(enc, len - 1, cv, &Q);
+            enc[len - 1] ^= 1;
+            bool off_curve = ecc_point_decode(enc, len, cv, &Q);
+            for (size_t i = 1; i <= L; i++) enc[i] = 0xFF;
+            enc[0] = ECC_POINT_COMPRESSED_EVEN;
+            bool x_too_big = ecc_point_decode(enc, 1 + L, cv, &Q);
+            bool short_buf = ecc_point_encode(P, cv, true, enc, L) != 0;
+            if (bad_tag || bad_len || off_curve || x_too_big || short_buf) {
+                printf("    ?  %d: Ƿδܾ\n", c);
+                passed = false;
+            }
+        }
+        if (passed) printf("    ? p = %llu: %zu һ / Ƿܾȷ\n", cv.p, N);
+    }
+
+    // 5. p = 1 (mod 8) : ѹ Tonelli-Shanks
+    if (passed) {
+        ECC_Curve ts = { 998244353ULL, 2, 3, 0 };
+        int found = 0;
+        for (uint64 x = 1; x < 200 && passed; x++) {
+            uint8 enc[5] = { ECC_POINT_COMPRESSED_ODD, 0, 0, 0, 0 };
+            enc[1] = (uint8)(x >> 24); enc[2] = (uint8)(x >> 16); enc[3] = (uint8)(x >> 8); enc[4] = (uint8)x;
+            ECC_Point P, Q;
+            if (!ecc_point_decode(enc, 5, ts, &P)) continue;
+            found++;
+            uint8 back[5];
+            passed = ecc_is_on_curve(P, ts) && (P.y & 1) == 1 &&
+                     ecc_point_encode(P, ts, true, back, 5) == 5 && memcmp(enc, back, 5) == 0 &&
+                     ecc_point_decode(back, 5, ts, &Q) && same_point(P, Q);
+        }
+        if (!passed || found == 0) {
+            printf("    ? p = 998244353 Ľѹ\n");
+            passed = false;
+        }
+        else {
+            printf("    ? p = 998244353 (2^23 | p - 1): %d ѹ\n", found);
+        }
+    }
+
+    // 6. : ſɱµĹԿ vs 
+    if (passed) {
+        const size_t M = 20000;
+        ECC_JacobianPoint* keys = new ECC_JacobianPoint[M];
+        uint8* out1 = new uint8[M * 9];
+        uint8* out2 = new uint8[M * 9];
+        for (size_t i = 0; i < M; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            keys[i] = ecc_jacobian_scalar_mult(seed % curve61.n, G61, curve61);
+        }
+        clock_t t0 = clock();
+        for (size_t i = 0; i < M; i++) ecc_point_encode(ecc_from_jacobian(keys[i], curve61), curve61, true, out1 + i * 9, 9);
+        clock_t t1 = clock();
+        ecc_point_encode_batch(keys, M, curve61, true, out2);
+        clock_t t2 = clock();
+        ECC_Point P;
+        size_t decoded = 0;
+        for (size_t i = 0; i < M; i++) decoded += ecc_point_decode(out2 + i * 9, 9, curve61, &P) ? 1 : 0;
+        clock_t t3 = clock();
+        double ts = (double)(t1 - t0) / CLOCKS_PER_SEC;
+        double tb = (double)(t2 - t1) / CLOCKS_PER_SEC;
+        double td = (double)(t3 - t2) / CLOCKS_PER_SEC;
+        printf("    [] %zu Կѹ:  %.3f s,  %.3f s ( %.1fx); ѹ %.0f /\n",
+            M, ts, tb, tb > 0 ? ts / tb : 0.0, td > 0 ? M / td : 0.0);
+        passed = decoded == M && memcmp(out1, out2, M * 9) == 0;
+        if (!passed) printf("    ? һ\n");
+        delete[] keys;
+        delete[] out1;
+        delete[] out2;
+    }
+
+    delete[] jp;
+    delete[] affine;
+    delete[] buf;
+    return passed;
+}
+
 extern "C" int test_ecc_main() {
-    if (test_ecc_full()) return 0;
+    if (test_ecc_full() && test_ecc_jacobian() && test_ecc_wnaf() && test_ecc_fixed_base() && test_ecdsa_double_mult() &&
+        test_ecdsa_verify_batch() && test_ecc_msm() && test_ecc_encoding()) return 0;
     return 1;
 }
\ No newline at end of file
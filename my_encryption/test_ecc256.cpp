@@ -0,0 +1,364 @@
+#include "ecc256.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static bool fe_equal_hex(const FE256* a, const char* hex) {
+    FE256 b;
+    fe256_from_hex(&b, hex);
+    return fe256_cmp(a, &b) == 0;
+}
+
+static bool point_equal_hex(const ECC256_Point* P, const char* x, const char* y) {
+    return !P->is_infinity && fe_equal_hex(&P->x, x) && fe_equal_hex(&P->y, y);
+}
+
+static void print_fe(const char* label, const FE256* a) {
+    printf("%s", label);
+    for (int i = 3; i >= 0; i--) printf("%016llx", a->v[i]);
+    printf("\n");
+}
+
+// 򵥵 64 λͬ࣬ɲõ 256 λ
+static uint64 lcg_state = 0x9E3779B97F4A7C15ULL;
+static void random_fe(FE256* r, const FE256* bound) {
+    for (int i = 0; i < 4; i++) {
+        lcg_state = lcg_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        r->v[i] = lcg_state ^ (lcg_state >> 29);
+    }
+    while (fe256_cmp(r, bound) >= 0) r->v[3] >>= 1;
+}
+
+// 1. : רԼͨ Montgomery Լ򽻲֤οֵȶ
+bool test_field256() {
+    printf("[ A] 256 λ:\n");
+    const char* a_hex = "0123456789abcdeffedcba98765432100123456789abcdeffedcba9876543210";
+    const char* b_hex = "fedcba98765432100123456789abcdeffedcba98765432100123456789abcdef";
+    const char* primes[3] = {
+        "ffffffff00000001000000000000000000000000ffffffffffffffffffffffff",
+        "fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f",
+        "ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551",
+    };
+    const char* expect[3] = {
+        "d13457c3411dc4f303bb5e86b7b547e711f77e9710c4b05c68f951ea2aeea142",
+        "7aad7f9b9930bdc4dcccb81670bf06bdcbb91037855134bf8ce321835a7b3b38",
+        "d8fa736b9b3f34032c7b75574390587cfdea2f477df3c6e89e0f03f8dd1d1a8f",
+    };
+    const char* names[3] = { "P-256 רԼ", "secp256k1 רԼ", "ͨ Montgomery" };
+    const int kinds[3] = { FIELD256_P256, FIELD256_SECP256K1, FIELD256_GENERIC };
+
+    for (int t = 0; t < 3; t++) {
+        FE256 p, a, b, fa, fb, fr, r;
+        fe256_from_hex(&p, primes[t]);
+        fe256_from_hex(&a, a_hex);
+        fe256_from_hex(&b, b_hex);
+        FIELD256 f;
+        field256_init(&f, &p);
+        if (f.kind != kinds[t]) {
+            printf("    ? %s: Լʽʶ\n", names[t]);
+            return false;
+        }
+        field256_to(&f, &fa, &a);
+        field256_to(&f, &fb, &b);
+        field256_mul(&f, &fr, &fa, &fb);
+        field256_from(&f, &r, &fr);
+        if (!fe_equal_hex(&r, expect[t])) {
+            printf("    ? %s: a * b \n", names[t]);
+            print_fe("      õ ", &r);
+            return false;
+        }
+
+        // ͬһǿ MontgomeryרԼȶ
+        FIELD256 g = f;
+        g.kind = FIELD256_GENERIC;
+        FE256 one = { { 1, 0, 0, 0 } };
+        field256_to(&g, &g.one, &one);
+        for (int i = 0; i < 2000; i++) {
+            FE256 x, y, r1, r2, gx, gy, t1, t2, inv;
+            random_fe(&x, &p);
+            random_fe(&y, &p);
+            // ǰȡ (p - 1)^2  (p - 1) * 1Լһμ p
+            if (i < 2) {
+                x = p;
+                x.v[0] -= 1;
+                y = (i == 0) ? x : one;
+            }
+            field256_to(&f, &t1, &x);
+            field256_to(&f, &t2, &y);
+            field256_mul(&f, &r1, &t1, &t2);
+            field256_from(&f, &r1, &r1);
+            field256_to(&g, &gx, &x);
+            field256_to(&g, &gy, &y);
+            field256_mul(&g, &r2, &gx, &gy);
+            field256_from(&g, &r2, &r2);
+            if (fe256_cmp(&r1, &r2) != 0) {
+                printf("    ? %s:  %d ˷ Montgomery һ\n", names[t], i);
+                return false;
+            }
+            field256_sqr(&f, &r1, &t1);
+            field256_mul(&f, &r2, &t1, &t1);
+            if (fe256_cmp(&r1, &r2) != 0) {
+                printf("    ? %s: ƽ˷һ\n", names[t]);
+                return false;
+            }
+            if (i % 100 == 0 && !fe256_is_zero(&t1)) {
+                field256_inv(&f, &inv, &t1);
+                field256_mul(&f, &r1, &inv, &t1);
+                if (fe256_cmp(&r1, &f.one) != 0) {
+                    printf("    ? %s: \n", names[t]);
+                    return false;
+                }
+            }
+        }
+        printf("    ? %s: οֵ2000 ˷ / ƽȷ\n", names[t]);
+    }
+    return true;
+}
+
+// 2. ߵı˷ ECDSA (RFC 6979 A.2.5  P-256 ˽Կ k)
+bool test_named_curves() {
+    printf("\n[ B] P-256 / secp256k1 ˷ ECDSA:\n");
+    const ECC256_Curve* curves[2] = { ecc256_curve_p256(), ecc256_curve_secp256k1() };
+    const char* names[2] = { "P-256", "secp256k1" };
+    const char* p2[2][2] = {
+        { "7cf27b188d034f7e8a52380304b51ac3c08969e277f21b35a60b48fc47669978", "07775510db8ed040293d9ac69f7430dbba7dade63ce982299e04b79d227873d1" },
+        { "c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5", "1ae168fea63dc339a3c58419466ceaeef7f632653266d0e1236431a950cfe52a" },
+    };
+    const char* p3[2][2] = {
+        { "5ecbe4d1a6330a44c8f7ef951d4bf165e6c6b721efada985fb41661bc6e7fd6c", "8734640c4998ff7e374b06ce1a64a2ecd82ab036384fb83d9a79b127a27d5032" },
+        { "f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9", "388f7b0f632de8140fe337e62a37f3566500a99934c2231b6cb9fd7584b8e672" },
+    };
+    const char* pub[2][2] = {
+        { "60fed4ba255a9d31c961eb74c6356d68c049b8923b61fa6ce669622e60f29fb6", "7903fe1008b8bc99a41ae9e95628bc64f2f1b20c2d7e9f5177a3c294d4462299" },
+        { "2c8c31fc9f990c6b55e3865a184a4ce50e09481f2eaeb3e60ec1cea13a6ae645", "64b95e4fdb6948c0386e189b006a29f686769b011704275e4459822dc3328085" },
+    };
+    const char* sig_rs[2][2] = {
+        { "efd48b2aacb6a8fd1140dd9cd45e81d69d2c877b56aaf991c34d0ea84eaf3716", "f7cb1c942d657c41d436c7a1b6e29f65f3e900dbb9aff4064dc4ab2f843acda8" },
+        { "432310e32cb80eb6503a26ce83cc165c783b870845fb8aad6d970889fcd7a6c8", "530128b6b81c548874a6305d93ed071ca6e05074d85863d4056ce89b02bfab69" },
+    };
+
+    FE256 d, k, hash_int;
+    fe256_from_hex(&d, "c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721");
+    fe256_from_hex(&k, "a6e3c57dd01abe90086538398355dd4c3b17aa873382b0f24d6129493d8aad60");
+    fe256_from_hex(&hash_int, "af2bdbe1aa9b6ec1e2ade1d694f41fc71a831d0268e9891562113d8a62add1bf"); // SHA-256("sample")
+    uint8 hash[32];
+    fe256_to_bytes(hash, &hash_int);
+
+    for (int c = 0; c < 2; c++) {
+        const ECC256_Curve* curve = curves[c];
+        ECC256_Point R, R2;
+        FE256 two = { { 2, 0, 0, 0 } }, three = { { 3, 0, 0, 0 } };
+
+        ecc256_scalar_mult(curve, &R, &two, &curve->G);
+        ecc256_scalar_mult_base(curve, &R2, &two);
+        if (!point_equal_hex(&R, p2[c][0], p2[c][1]) || !point_equal_hex(&R2, p2[c][0], p2[c][1])) {
+            printf("    ? %s: 2G \n", names[c]);
+            return false;
+        }
+        ecc256_point_add(curve, &R2, &R, &curve->G);
+        ecc256_scalar_mult(curve, &R, &three, &curve->G);
+        if (!point_equal_hex(&R, p3[c][0], p3[c][1]) || !point_equal_hex(&R2, p3[c][0], p3[c][1])) {
+            printf("    ? %s: 3G \n", names[c]);
+            return false;
+        }
+
+        // n * G = O(n - 1) * G = -G
+        FE256 n = curve->order.p, n1 = n;
+        n1.v[0] -= 1;
+        ecc256_scalar_mult(curve, &R, &n, &curve->G);
+        ecc256_scalar_mult_base(curve, &R2, &n1);
+        FE256 neg_y;
+        FE256 zero = { { 0, 0, 0, 0 } };
+        field256_sub(&curve->field, &neg_y, &zero, &curve->G.y);
+        if (!R.is_infinity || fe256_cmp(&R2.x, &curve->G.x) != 0 || fe256_cmp(&R2.y, &neg_y) != 0) {
+            printf("    ? %s: nG / (n-1)G \n", names[c]);
+            return false;
+        }
+
+        // Ϊ 0 ϡ: ̶˷ĳʱ밴ĵ
+        const char* sparse[3] = {
+            "8000000000000000000000000000000000000000000000000000000000000000",
+            "f000000000000000000000000000000000000000000000000000000000000000",
+            "100000000000000000000000000000000000000000000000000000000000000f",
+        };
+        for (int i = 0; i < 3; i++) {
+            FE256 s;
+            fe256_from_hex(&s, sparse[i]);
+            ecc256_scalar_mult(curve, &R, &s, &curve->G);
+            ecc256_scalar_mult_base(curve, &R2, &s);
+            if (fe256_cmp(&R.x, &R2.x) != 0 || fe256_cmp(&R.y, &R2.y) != 0) {
+                printf("    ? %s: ϡ %d ֳ˷һ\n", names[c], i);
+                return false;
+            }
+        }
+
+        // : wNAF ̶һ£
+        for (int i = 0; i < 20; i++) {
+            FE256 s;
+            random_fe(&s, &n);
+            ecc256_scalar_mult(curve, &R, &s, &curve->G);
+            ecc256_scalar_mult_base(curve, &R2, &s);
+            if (fe256_cmp(&R.x, &R2.x) != 0 || fe256_cmp(&R.y, &R2.y) != 0 || !ecc256_is_on_curve(curve, &R)) {
+                printf("    ? %s:  %d һ\n", names[c], i);
+                return false;
+            }
+        }
+
+        // ĳʱ˷: k (aG)  (ka mod n) G һ£k ȡϡֵֵ n - 1
+        {
+            FE256 a, ma, s, ms, ka;
+            random_fe(&a, &n);
+            ECC256_Point A;
+            ecc256_scalar_mult_base(curve, &A, &a);
+            field256_to(&curve->order, &ma, &a);
+            for (int i = 0; i < 24; i++) {
+                if (i < 3) fe256_from_hex(&s, sparse[i]);
+                else if (i == 3) s = n1;
+                else random_fe(&s, &n);
+                field256_to(&curve->order, &ms, &s);
+                field256_mul(&curve->order, &ka, &ms, &ma);
+                field256_from(&curve->order, &ka, &ka);
+                ecc256_scalar_mult(curve, &R, &s, &A);
+                ecc256_scalar_mult_base(curve, &R2, &ka);
+                if (fe256_cmp(&R.x, &R2.x) != 0 || fe256_cmp(&R.y, &R2.y) != 0 || R.is_infinity != R2.is_infinity) {
+                    printf("    ? %s:  %d  k (aG)  (ka) G һ\n", names[c], i);
+                    return false;
+                }
+            }
+        }
+
+        // ECDSA
+        ECC256_Point Q;
+        ECC256_Signature sig;
+        if (!ecc256_generate_public(curve, &d, &Q) || !point_equal_hex(&Q, pub[c][0], pub[c][1])) {
+            printf("    ? %s: Կ\n", names[c]);
+            return false;
+        }
+        if (!ecdsa256_sign(curve, hash, &k, &d, &sig) ||
+            !fe_equal_hex(&sig.r, sig_rs[c][0]) || !fe_equal_hex(&sig.s, sig_rs[c][1])) {
+            printf("    ? %s: ǩοֵһ\n", names[c]);
+            print_fe("      r = ", &sig.r);
+            print_fe("      s = ", &sig.s);
+            return false;
+        }
+        uint8 bad_hash[32];
+        memcpy(bad_hash, hash, 32);
+        bad_hash[31] ^= 1;
+        ECC256_Signature bad_sig = sig;
+        bad_sig.s.v[0] ^= 4;
+        if (!ecdsa256_verify(curve, hash, &sig, &Q) || ecdsa256_verify(curve, bad_hash, &sig, &Q) ||
+            ecdsa256_verify(curve, hash, &bad_sig, &Q) || ecdsa256_verify(curve, hash, &sig, &curve->G)) {
+            printf("    ? %s: ǩȷ\n", names[c]);
+            return false;
+        }
+        printf("    ? %s: 2G / 3G / nG㳣ʱ˷RFC 6979 Կǩǩȷ\n", names[c]);
+    }
+    return true;
+}
+
+// 3. Զ (ͨ Montgomery ): y^2 = x^3 + 5x + 7 over GF(P-256 Ľ)
+bool test_custom_curve() {
+    printf("\n[ C] Զ (Montgomery Լ):\n");
+    FE256 p, a, b, gx, gy, k;
+    fe256_from_hex(&p, "ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551");
+    fe256_from_hex(&a, "5");
+    fe256_from_hex(&b, "7");
+    fe256_from_hex(&gx, "2");
+    fe256_from_hex(&gy, "ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc63254c");
+    ECC256_Curve curve;
+    // ߵȺδֻ֪Ե㣬 p 
+    if (!ecc256_curve_init(&curve, &p, &a, &b, &p, &gx, &gy)) return false;
+    if (curve.field.kind != FIELD256_GENERIC || curve.a_kind != ECC256_A_GENERIC) {
+        printf("    ? ʶ\n");
+        ecc256_curve_free(&curve);
+        return false;
+    }
+
+    ECC256_Point R, R2;
+    fe256_from_hex(&k, "123456789abcdef0fedcba9876543210");
+    ecc256_scalar_mult(&curve, &R, &k, &curve.G);
+    ecc256_scalar_mult_base(&curve, &R2, &k);
+    bool ok = point_equal_hex(&R, "21393792b43720a9fabcffc9d35f22e47e93aecdbbe6a1541630e95f51e1f661",
+                                  "c887a2531c7b24f027bf37154d2d6fa927d939916917dd195a8edd19d0bc2a08") &&
+              fe256_cmp(&R.x, &R2.x) == 0 && fe256_cmp(&R.y, &R2.y) == 0;
+
+    // ηӵĽȶ
+    ECC256_Point acc;
+    memset(&acc, 0, sizeof(acc));
+    acc.is_infinity = true;
+    for (uint64 i = 1; ok && i <= 40; i++) {
+        ecc256_point_add(&curve, &acc, &acc, &curve.G);
+        FE256 s = { { i, 0, 0, 0 } };
+        ecc256_scalar_mult(&curve, &R, &s, &curve.G);
+        ecc256_scalar_mult_base(&curve, &R2, &s);
+        ok = fe256_cmp(&R.x, &acc.x) == 0 && fe256_cmp(&R.y, &acc.y) == 0 &&
+             fe256_cmp(&R2.x, &acc.x) == 0 && fe256_cmp(&R2.y, &acc.y) == 0;
+    }
+    ecc256_curve_free(&curve);
+    if (!ok) {
+        printf("    ? Զ߱˷\n");
+        return false;
+    }
+    printf("    ? οֵ 1..40 ȷ\n");
+    return true;
+}
+
+// 4. 
+void bench_ecc256() {
+    printf("\n[] 256 λ:\n");
+    const ECC256_Curve* curves[2] = { ecc256_curve_p256(), ecc256_curve_secp256k1() };
+    const char* names[2] = { "P-256", "secp256k1" };
+
+    // ˷: רԼ vs Montgomery
+    for (int c = 0; c < 2; c++) {
+        FIELD256 g = curves[c]->field;
+        g.kind = FIELD256_GENERIC;
+        FE256 x, y;
+        random_fe(&x, &g.p);
+        random_fe(&y, &g.p);
+        const int rounds = 1000000;
+        clock_t t0 = clock();
+        for (int i = 0; i < rounds; i++) field256_mul(&curves[c]->field, &x, &x, &y);
+        clock_t t1 = clock();
+        for (int i = 0; i < rounds; i++) field256_mul(&g, &x, &x, &y);
+        clock_t t2 = clock();
+        double ts = (double)(t1 - t0) / CLOCKS_PER_SEC, tm = (double)(t2 - t1) / CLOCKS_PER_SEC;
+        printf("    %-9s ˷: רԼ %.1f ns, Montgomery %.1f ns [%llu]\n", names[c],
+            ts * 1e9 / rounds, tm * 1e9 / rounds, x.v[0] & 1);
+    }
+
+    uint8 hash[32];
+    for (int i = 0; i < 32; i++) hash[i] = (uint8)(i * 7 + 1);
+    for (int c = 0; c < 2; c++) {
+        const ECC256_Curve* curve = curves[c];
+        FE256 d, k;
+        random_fe(&d, &curve->order.p);
+        ECC256_Point Q, R;
+        ecc256_generate_public(curve, &d, &Q);
+
+        const int rounds = 500;
+        clock_t t0 = clock();
+        for (int i = 0; i < rounds; i++) { random_fe(&k, &curve->order.p); ecc256_scalar_mult(curve, &R, &k, &Q); }
+        clock_t t1 = clock();
+        ECC256_Signature sig;
+        for (int i = 0; i < rounds; i++) { random_fe(&k, &curve->order.p); ecdsa256_sign(curve, hash, &k, &d, &sig); }
+        clock_t t2 = clock();
+        int ok = 0;
+        for (int i = 0; i < rounds; i++) ok += ecdsa256_verify(curve, hash, &sig, &Q) ? 1 : 0;
+        clock_t t3 = clock();
+        double tm = (double)(t1 - t0) / CLOCKS_PER_SEC;
+        double ts = (double)(t2 - t1) / CLOCKS_PER_SEC;
+        double tv = (double)(t3 - t2) / CLOCKS_PER_SEC;
+        printf("    %-9s k*P %.0f /, ǩ %.0f /, ǩ %.0f / [%d]\n", names[c],
+            tm > 0 ? rounds / tm : 0.0, ts > 0 ? rounds / ts : 0.0, tv > 0 ? rounds / tv : 0.0, ok);
+    }
+}
+
+extern "C" int test_ecc256_main() {
+    printf("===========================================\n");
+    printf("       ECC256 256 λԲ߲\n");
+    printf("===========================================\n");
+    if (!test_field256() || !test_named_curves() || !test_custom_curve()) return 1;
+    bench_ecc256();
+    return 0;
+}
\ No newline at end of file
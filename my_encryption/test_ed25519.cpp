@@ -0,0 +1,278 @@
+#include "ed25519.h"
+#include "ecc256.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static bool bytes_equal_hex(const uint8* a, const char* hex, size_t len) {
+    uint8 b[ED25519_SIGNATURE_SIZE];
+    hex_to_bytes(hex, b, len);
+    return memcmp(a, b, len) == 0;
+}
+
+static uint64 rng_state = 0x9E3779B97F4A7C15ULL;
+
+// 1. RFC 8032 7.1 ڲ 1-3
+bool test_ed25519_vectors() {
+    printf("[ A] RFC 8032 :\n");
+    const char* cases[3][4] = {
+        { "9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60", "",
+          "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a",
+          "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b" },
+        { "4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb", "72",
+          "3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c",
+          "92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00" },
+        { "c5aa8df43f9f837bedb7442f31dcb7b166d38535076f094b85ce3a2e0b4458f7", "af82",
+          "fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025",
+          "6291d657deec24024827e69c3abe01a30ce548a284743a445e3680d7db5ac3ac18ff9b538d16f290ae67f760984dc6594a7c15e9716ed28dc027beceea1ec40a" },
+    };
+    for (int i = 0; i < 3; i++) {
+        uint8 seed[32], msg[2], pub[32], sig[64];
+        size_t msg_len = strlen(cases[i][1]) / 2;
+        hex_to_bytes(cases[i][0], seed, 32);
+        hex_to_bytes(cases[i][1], msg, msg_len);
+        ed25519_public_key(pub, seed);
+        ED25519_KeyPair kp;
+        ed25519_keypair_from_seed(&kp, seed);
+        if (!bytes_equal_hex(pub, cases[i][2], 32) || memcmp(kp.pub, pub, 32) != 0) {
+            printf("    ?  %d Կ\n", i + 1);
+            print_hex("      õ", pub, 32);
+            return false;
+        }
+        ed25519_sign(sig, msg, msg_len, &kp);
+        if (!bytes_equal_hex(sig, cases[i][3], 64)) {
+            printf("    ?  %d ǩ\n", i + 1);
+            print_hex("      õ", sig, 64);
+            return false;
+        }
+        if (!ed25519_verify(sig, msg, msg_len, pub)) {
+            printf("    ?  %d ǩʧ\n", i + 1);
+            return false;
+        }
+    }
+
+    //  / 
+    for (int i = 0; i < 50; i++) {
+        uint8 k[32], enc[32], enc2[32];
+        seeded_random_bytes(&rng_state, k, 32);
+        k[31] &= 127;
+        ED25519_Point P;
+        ed25519_scalar_mult_base(&P, k);
+        ed25519_point_encode(enc, &P);
+        if (!ed25519_point_decode(&P, enc)) {
+            printf("    ?  %d ʧ\n", i);
+            return false;
+        }
+        ed25519_point_encode(enc2, &P);
+        if (memcmp(enc, enc2, 32) != 0) {
+            printf("    ?  %d һ\n", i);
+            return false;
+        }
+    }
+    printf("    ? 鹫Կ / ǩ / ǩ50 ıȷ\n");
+    return true;
+}
+
+// 2. ۸ϢǩԿԼǹ淶Ӧܾ
+bool test_ed25519_reject() {
+    printf("\n[ B] Ƿǩܾ:\n");
+    uint8 seed[32], pub[32], sig[64], bad[64], other_pub[32];
+    uint8 msg[100];
+    seeded_random_bytes(&rng_state, seed, 32);
+    seeded_random_bytes(&rng_state, msg, sizeof(msg));
+    ED25519_KeyPair kp;
+    ed25519_keypair_from_seed(&kp, seed);
+    memcpy(pub, kp.pub, 32);
+    ed25519_sign(sig, msg, sizeof(msg), &kp);
+    if (!ed25519_verify(sig, msg, sizeof(msg), pub)) {
+        printf("    ? ǩǩʧ\n");
+        return false;
+    }
+
+    bool passed = true;
+    msg[7] ^= 1;
+    if (ed25519_verify(sig, msg, sizeof(msg), pub)) { printf("    ? ۸Ϣδܾ\n"); passed = false; }
+    msg[7] ^= 1;
+
+    memcpy(bad, sig, 64);
+    bad[3] ^= 0x10;
+    if (ed25519_verify(bad, msg, sizeof(msg), pub)) { printf("    ? ۸ R δܾ\n"); passed = false; }
+
+    memcpy(bad, sig, 64);
+    bad[40] ^= 0x01;
+    if (ed25519_verify(bad, msg, sizeof(msg), pub)) { printf("    ? ۸ S δܾ\n"); passed = false; }
+
+    // S + L  S ͬ࣬ǹ淶
+    static const uint8 L_bytes[32] = {
+        0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x10 };
+    memcpy(bad, sig, 64);
+    unsigned carry = 0;
+    for (int i = 0; i < 32; i++) {
+        carry += (unsigned)bad[32 + i] + L_bytes[i];
+        bad[32 + i] = (uint8)carry;
+        carry >>= 8;
+    }
+    if (ed25519_verify(bad, msg, sizeof(msg), pub)) { printf("    ? S >= L δܾ\n"); passed = false; }
+
+    seeded_random_bytes(&rng_state, seed, 32);
+    ed25519_public_key(other_pub, seed);
+    if (ed25519_verify(sig, msg, sizeof(msg), other_pub)) { printf("    ? Կδܾ\n"); passed = false; }
+
+    // y = p (ǹ淶)  x ڵ y = 2 Ӧʧ
+    ED25519_Point P;
+    uint8 enc[32];
+    hex_to_bytes("edffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f", enc, 32);
+    if (ed25519_point_decode(&P, enc)) { printf("    ? y = p δܾ\n"); passed = false; }
+    memset(enc, 0, 32);
+    enc[0] = 2;
+    if (ed25519_point_decode(&P, enc)) { printf("    ?  y = 2 δܾ\n"); passed = false; }
+
+    if (passed) printf("    ? ۸Ϣ / R / SS >= LԿǹ淶ܾ\n");
+    return passed;
+}
+
+// 3. ǩǩһ (ΡЧǩ)
+bool test_ed25519_batch() {
+    printf("\n[ C] ǩ:\n");
+    const size_t N = 300, MSG_LEN = 48;
+    uint8* seeds = new uint8[N * 32];
+    uint8* pubs = new uint8[N * 32];
+    uint8* sigs = new uint8[N * 64];
+    uint8* msg_buf = new uint8[N * MSG_LEN];
+    const uint8** msgs = new const uint8*[N];
+    size_t* lens = new size_t[N];
+    bool* ok = new bool[N];
+
+    seeded_random_bytes(&rng_state, seeds, N * 32);
+    seeded_random_bytes(&rng_state, msg_buf, N * MSG_LEN);
+    for (size_t i = 0; i < N; i++) {
+        ED25519_KeyPair kp;
+        msgs[i] = msg_buf + i * MSG_LEN;
+        lens[i] = MSG_LEN - (i % 5);
+        ed25519_keypair_from_seed(&kp, seeds + i * 32);
+        memcpy(pubs + i * 32, kp.pub, 32);
+        ed25519_sign(sigs + i * 64, msgs[i], lens[i], &kp);
+    }
+
+    bool passed = ed25519_verify_batch(msgs, lens, sigs, pubs, ok, N, 0) == N;
+    for (size_t i = 0; i < N && passed; i++) passed = ok[i];
+    if (!passed) printf("    ? %zu Чǩδȫͨ\n", N);
+
+    if (passed) {
+        //  2 δ۸ S 3 δ۸Ϣ 1 λԿһλԪԿ + λԪ RS = 0 ǩ
+        // (ǩµ)
+        sigs[130 * 64 + 40] ^= 1;
+        msg_buf[260 * MSG_LEN] ^= 1;
+        memcpy(pubs + 7 * 32, pubs + 8 * 32, 32);
+        memset(pubs + 20 * 32, 0, 32);
+        pubs[20 * 32] = 1;
+        memset(sigs + 20 * 64, 0, 64);
+        sigs[20 * 64] = 1;
+        size_t valid = ed25519_verify_batch(msgs, lens, sigs, pubs, ok, N, 0);
+        size_t expect_valid = 0;
+        for (size_t i = 0; i < N && passed; i++) {
+            bool e = ed25519_verify(sigs + i * 64, msgs[i], lens[i], pubs + i * 32);
+            expect_valid += e ? 1 : 0;
+            passed = ok[i] == e;
+        }
+        if (!passed || valid != expect_valid || valid != N - 3 || ok[7] || ok[130] || ok[260] || !ok[20]) {
+            printf("    ? Чǩʱǩһ\n");
+            passed = false;
+        }
+    }
+    if (passed) printf("    ? %zu ǩ (3 Ч1 С׹Կ) ǩһ\n", N);
+
+    delete[] seeds;
+    delete[] pubs;
+    delete[] sigs;
+    delete[] msg_buf;
+    delete[] msgs;
+    delete[] lens;
+    delete[] ok;
+    return passed;
+}
+
+// 4. : ǩǩǩ P-256 ECDSA 
+void bench_ed25519() {
+    printf("\n[] Ed25519:\n");
+    const size_t N = 1024, MSG_LEN = 64;
+    uint8* seeds = new uint8[N * 32];
+    uint8* pubs = new uint8[N * 32];
+    uint8* sigs = new uint8[N * 64];
+    uint8* msg_buf = new uint8[N * MSG_LEN];
+    const uint8** msgs = new const uint8*[N];
+    size_t* lens = new size_t[N];
+    ED25519_KeyPair* keys = new ED25519_KeyPair[N];
+    seeded_random_bytes(&rng_state, seeds, N * 32);
+    seeded_random_bytes(&rng_state, msg_buf, N * MSG_LEN);
+    for (size_t i = 0; i < N; i++) {
+        msgs[i] = msg_buf + i * MSG_LEN;
+        lens[i] = MSG_LEN;
+        ed25519_keypair_from_seed(&keys[i], seeds + i * 32);
+        memcpy(pubs + i * 32, keys[i].pub, 32);
+    }
+
+    clock_t t0 = clock();
+    for (size_t i = 0; i < N; i++) ed25519_sign(sigs + i * 64, msgs[i], lens[i], &keys[i]);
+    double t_sign = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    size_t ok = 0;
+    t0 = clock();
+    for (size_t i = 0; i < N; i++) ok += ed25519_verify(sigs + i * 64, msgs[i], lens[i], pubs + i * 32) ? 1 : 0;
+    double t_verify = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    size_t ok_batch = ed25519_verify_batch(msgs, lens, sigs, pubs, NULL, N, 1);
+    double t_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    size_t ok_threads = ed25519_verify_batch(msgs, lens, sigs, pubs, NULL, N, 0);
+    double t_threads = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    if (t_sign > 0) printf("    ed25519_sign:           %.0f /\n", N / t_sign);
+    if (t_verify > 0) printf("    ed25519_verify:         %.0f / [%zu]\n", N / t_verify, ok);
+    if (t_batch > 0) printf("    ed25519_verify_batch:   %.0f / (߳) [%zu]\n", N / t_batch, ok_batch);
+    if (t_threads > 0) printf("    ed25519_verify_batch:   %.0f / (ȫģ CPU ʱ) [%zu]\n", N / t_threads, ok_threads);
+
+    // ͬȰȫ P-256 ECDSA 
+    const ECC256_Curve* curve = ecc256_curve_p256();
+    FE256 d, k;
+    ECC256_Point Q;
+    ECC256_Signature sig;
+    uint8 hash[32];
+    for (int i = 0; i < 32; i++) hash[i] = (uint8)(i * 7 + 1);
+    memset(&d, 0, sizeof(d));
+    d.v[0] = 0x123456789abcdefULL;
+    d.v[2] = 0xfedcba987654321ULL;
+    ecc256_generate_public(curve, &d, &Q);
+    const int rounds = 500;
+    t0 = clock();
+    for (int i = 0; i < rounds; i++) {
+        k = d;
+        k.v[1] = (uint64)i * 0x9E3779B97F4A7C15ULL;
+        ecdsa256_sign(curve, hash, &k, &d, &sig);
+    }
+    double t_ecdsa_sign = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    int ecdsa_ok = 0;
+    t0 = clock();
+    for (int i = 0; i < rounds; i++) ecdsa_ok += ecdsa256_verify(curve, hash, &sig, &Q) ? 1 : 0;
+    double t_ecdsa_verify = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    if (t_ecdsa_sign > 0 && t_ecdsa_verify > 0) {
+        printf("    P-256 ECDSA:            ǩ %.0f /, ǩ %.0f / [%d]\n",
+            rounds / t_ecdsa_sign, rounds / t_ecdsa_verify, ecdsa_ok);
+    }
+
+    delete[] seeds;
+    delete[] pubs;
+    delete[] sigs;
+    delete[] msg_buf;
+    delete[] msgs;
+    delete[] lens;
+    delete[] keys;
+}
+
+extern "C" int test_ed25519_main() {
+    printf("===========================================\n");
+    printf("       Ed25519 ǩ\n");
+    printf("===========================================\n");
+    if (!test_ed25519_vectors() || !test_ed25519_reject() || !test_ed25519_batch()) return 1;
+    bench_ed25519();
+    return 0;
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "elgamal.h"
 #include <stdio.h>
+#include <time.h>
 
 // ӡԿϢ
 void print_elgamal_key(const char* label, uint64 p, uint64 g, uint64 y) {
@@ -90,9 +91,123 @@ bool test_elgamal_full() {
     return true;
 }
 
+// 32 λµǩ/ǩ: y^r * r^s öͬʱģݺ벻
+bool test_elgamal_multi_power() {
+    printf("\n[ģ] ElGamal ǩ (p = 4294967291, g = 2):\n");
+    const uint64 p = 4294967291ULL;
+    ElGamal_PublicKey pub;
+    ElGamal_PrivateKey priv;
+    elgamal_generate_keys(p, 2, 1234567891ULL, &pub, &priv);
+
+    const int N = 2000;
+    static uint64 msgs[N];
+    static ElGamal_Signature sigs[N];
+    uint64 seed = 777;
+    for (int i = 0; i < N; i++) {
+        // k  p-1 ʣѡֱ
+        uint64 k;
+        int64 u, v;
+        do {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            k = (seed >> 32) % (p - 2) + 1;
+        } while (extended_gcd(k, p - 1, &u, &v) != 1);
+        msgs[i] = (seed >> 8) % (p - 1);
+        sigs[i] = elgamal_sign(msgs[i], k, &priv);
+    }
+
+    for (int i = 0; i < N; i++) {
+        if (!elgamal_verify(msgs[i], sigs[i], &pub) || elgamal_verify(msgs[i] + 1, sigs[i], &pub)) {
+            printf("    ?  %d ǩ֤\n", i);
+            return false;
+        }
+    }
+    printf("    ? %d ǩȫͨ۸Ϣȫܾ\n", N);
+
+    // : д (ζģ) 뵱ǰ elgamal_verify
+    int ok_old = 0, ok_new = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < N; i++) {
+        uint64 lhs = mul_mod(power(pub.y, sigs[i].r, p), power(sigs[i].r, sigs[i].s, p), p);
+        ok_old += (lhs == power(pub.g, msgs[i], p));
+    }
+    double t_old = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    for (int i = 0; i < N; i++) ok_new += elgamal_verify(msgs[i], sigs[i], &pub);
+    double t_new = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] %d ǩ:\n", N);
+    if (t_old > 0) printf("    ζģ:   %.0f /\n", N / t_old);
+    if (t_new > 0) printf("    elgamal_verify: %.0f /\n", N / t_new);
+    return ok_old == N && ok_new == N;
+}
+
+// :  elgamal_decrypt һ ( 61 λģ)
+bool test_elgamal_decrypt_batch() {
+    printf("\n[] ܶ:\n");
+    const uint64 moduli[] = { 467, 4294967291ULL, 2305843009213693951ULL };
+    const size_t N = 2000;
+    ElGamal_Ciphertext* cts = new ElGamal_Ciphertext[N];
+    uint64* msgs = new uint64[N];
+    uint64* out = new uint64[N];
+    bool passed = true;
+
+    for (size_t t = 0; t < sizeof(moduli) / sizeof(moduli[0]) && passed; t++) {
+        uint64 p = moduli[t];
+        ElGamal_PublicKey pub;
+        ElGamal_PrivateKey priv;
+        elgamal_generate_keys(p, 3, (p - 1) / 3 + 17, &pub, &priv);
+
+        uint64 seed = 2024 + t;
+        for (size_t i = 0; i < N; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            msgs[i] = (seed >> 7) % p;
+            cts[i] = elgamal_encrypt(msgs[i], (seed >> 13) % (p - 2) + 1, &pub);
+        }
+        cts[5].c1 = 0; // Ч
+
+        size_t ok = elgamal_decrypt_batch(cts, out, N, &priv, 0);
+        if (ok != N - 1 || out[5] != 0) passed = false;
+        for (size_t i = 0; i < N && passed; i++) {
+            if (i == 5) continue;
+            if (out[i] != msgs[i] || out[i] != elgamal_decrypt(cts[i], &priv)) {
+                printf("    ?  %zu ܴ (p=%llu)\n", i, p);
+                passed = false;
+            }
+        }
+        if (passed) printf("    ? p=%llu: %zu ȷЧı\n", p, ok);
+    }
+
+    if (passed) {
+        uint64 p = 2305843009213693951ULL;
+        ElGamal_PublicKey pub;
+        ElGamal_PrivateKey priv;
+        elgamal_generate_keys(p, 3, 987654321987654321ULL, &pub, &priv);
+        for (size_t i = 0; i < N; i++) cts[i] = elgamal_encrypt(i + 1, i * 7919 + 11, &pub);
+
+        uint64 acc = 0;
+        clock_t t0 = clock();
+        for (size_t i = 0; i < N; i++) acc += elgamal_decrypt(cts[i], &priv);
+        double t_single = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        t0 = clock();
+        elgamal_decrypt_batch(cts, out, N, &priv, 1);
+        double t_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        for (size_t i = 0; i < N; i++) acc -= out[i];
+
+        printf("\n[] %zu  (p=%llu):\n", N, p);
+        if (t_single > 0) printf("    elgamal_decrypt:       %.0f /\n", N / t_single);
+        if (t_batch > 0) printf("    elgamal_decrypt_batch: %.0f / (߳)\n", N / t_batch);
+        passed = (acc == 0);
+    }
+
+    delete[] cts;
+    delete[] msgs;
+    delete[] out;
+    return passed;
+}
+
 // 
 extern "C" int test_elgamal_main() {
-    if (test_elgamal_full()) {
+    if (test_elgamal_full() && test_elgamal_multi_power() && test_elgamal_decrypt_batch()) {
         return 0;
     }
     return 1;
@@ -1,11 +1,14 @@
 #include "hash.h"
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+#include <time.h>
 
 // : 㲢ӡ
-void test_sha256_vector(const char* input_str, const char* expected_hex) {
+bool test_sha256_vector(const char* input_str, const char* expected_hex) {
     SHA256_CTX ctx;
     uint8 hash[SHA256_BLOCK_SIZE];
+    uint8 expected[SHA256_BLOCK_SIZE];
 
     sha256_init(&ctx);
     sha256_update(&ctx, (const uint8*)input_str, strlen(input_str));
@@ -13,28 +16,158 @@ void test_sha256_vector(const char* input_str, const char* expected_hex) {
 
     printf(": \"%s\"\n", input_str);
     print_hex("ϣ", hash, SHA256_BLOCK_SIZE);
-    // Ϊʾ򵥣۱ȶԼɣд hex_to_bytes  memcmp
-    printf(": %s ...\n\n", expected_hex);
+    printf(": %s\n\n", expected_hex);
+
+    hex_to_bytes(expected_hex, expected, SHA256_BLOCK_SIZE);
+    return memcmp(hash, expected, SHA256_BLOCK_SIZE) == 0;
+}
+
+// : SHA-512  (variant: 512 / 384 / 256 ʾ SHA-512/256)
+static bool test_sha512_vector(int variant, const char* input_str, const char* expected_hex) {
+    SHA512_CTX ctx;
+    uint8 hash[SHA512_BLOCK_SIZE];
+    uint8 expected[SHA512_BLOCK_SIZE];
+    size_t len = strlen(input_str);
+    size_t out_len;
+    const char* name;
+
+    if (variant == 512) {
+        sha512_init(&ctx);
+        sha512_update(&ctx, (const uint8*)input_str, len);
+        sha512_final(&ctx, hash);
+        out_len = SHA512_BLOCK_SIZE; name = "SHA-512";
+    }
+    else if (variant == 384) {
+        sha384_init(&ctx);
+        sha384_update(&ctx, (const uint8*)input_str, len);
+        sha384_final(&ctx, hash);
+        out_len = SHA384_BLOCK_SIZE; name = "SHA-384";
+    }
+    else {
+        sha512_256_init(&ctx);
+        sha512_256_update(&ctx, (const uint8*)input_str, len);
+        sha512_256_final(&ctx, hash);
+        out_len = SHA512_256_BLOCK_SIZE; name = "SHA-512/256";
+    }
+
+    hex_to_bytes(expected_hex, expected, out_len);
+    bool ok = memcmp(hash, expected, out_len) == 0;
+    printf("%-12s (\"%.16s%s\"): %s\n", name, input_str, len > 16 ? "..." : "", ok ? "ͨ" : "ʧ");
+    if (!ok) print_hex("    ʵ", hash, out_len);
+    return ok;
+}
+
+// ʽֿһһ (㿽·뻺ƴ·)
+static bool test_streaming_split() {
+    uint8 buf[1000];
+    uint8 h1[SHA512_BLOCK_SIZE], h2[SHA512_BLOCK_SIZE];
+    for (int i = 0; i < 1000; i++) buf[i] = (uint8)(i * 7 + 3);
+
+    SHA256_CTX c256;
+    sha256_init(&c256);
+    sha256_update(&c256, buf, sizeof(buf));
+    sha256_final(&c256, h1);
+    sha256_init(&c256);
+    for (size_t off = 0, step = 1; off < sizeof(buf); off += step, step = step * 3 % 97 + 1) {
+        size_t n = (off + step > sizeof(buf)) ? sizeof(buf) - off : step;
+        sha256_update(&c256, buf + off, n);
+    }
+    sha256_final(&c256, h2);
+    if (memcmp(h1, h2, SHA256_BLOCK_SIZE) != 0) return false;
+
+    SHA512_CTX c512;
+    sha512_init(&c512);
+    sha512_update(&c512, buf, sizeof(buf));
+    sha512_final(&c512, h1);
+    sha512_init(&c512);
+    for (size_t off = 0, step = 1; off < sizeof(buf); off += step, step = step * 5 % 211 + 1) {
+        size_t n = (off + step > sizeof(buf)) ? sizeof(buf) - off : step;
+        sha512_update(&c512, buf + off, n);
+    }
+    sha512_final(&c512, h2);
+    return memcmp(h1, h2, SHA512_BLOCK_SIZE) == 0;
+}
+
+// ܶԱ: SHA-256  SHA-512  (MB/s)
+static void bench_hash() {
+    const size_t BUF_SIZE = 1 << 20; // 1 MB
+    const int ROUNDS = 16;
+    uint8* buf = (uint8*)malloc(BUF_SIZE);
+    uint8 out[SHA512_BLOCK_SIZE];
+    if (!buf) return;
+    memset(buf, 0xA5, BUF_SIZE);
+
+    clock_t t0 = clock();
+    SHA256_CTX c256;
+    sha256_init(&c256);
+    for (int r = 0; r < ROUNDS; r++) sha256_update(&c256, buf, BUF_SIZE);
+    sha256_final(&c256, out);
+    double s256 = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    SHA512_CTX c512;
+    sha512_init(&c512);
+    for (int r = 0; r < ROUNDS; r++) sha512_update(&c512, buf, BUF_SIZE);
+    sha512_final(&c512, out);
+    double s512 = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[]  %d MB ϣ:\n", ROUNDS);
+    if (s256 > 0) printf("    SHA-256: %.1f MB/s\n", ROUNDS / s256);
+    if (s512 > 0) printf("    SHA-512: %.1f MB/s\n", ROUNDS / s512);
+    free(buf);
 }
 
 bool test_hash_full() {
+    bool ok = true;
+
     printf("===========================================\n");
     printf("          SHA-256 ϣ㷨\n");
     printf("===========================================\n");
 
     // 1. ַ
-    // : e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855
-    test_sha256_vector("", "E3B0C442...");
+    ok &= test_sha256_vector("", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
 
     // 2. "abc"
-    // : ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad
-    test_sha256_vector("abc", "BA7816BF...");
+    ok &= test_sha256_vector("abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+    // 3. ַ (56 ֽڣҪһ)
+    ok &= test_sha256_vector("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+        "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+
+    printf("===========================================\n");
+    printf("     SHA-512 / SHA-384 / SHA-512/256 \n");
+    printf("===========================================\n");
+
+    const char* long_msg = "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+        "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+    ok &= test_sha512_vector(512, "",
+        "cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
+        "47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e");
+    ok &= test_sha512_vector(512, "abc",
+        "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+        "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+    ok &= test_sha512_vector(512, long_msg,
+        "8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018"
+        "501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909");
+    ok &= test_sha512_vector(384, "abc",
+        "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded163"
+        "1a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7");
+    ok &= test_sha512_vector(384, long_msg,
+        "09330c33f71147e83d192fc782cd1b4753111b173b3b05d2"
+        "2fa08086e3b0f712fcc7c71a557e2db966c3e9fa91746039");
+    ok &= test_sha512_vector(256, "abc",
+        "53048e2681941ef99b2e29b76b4c7dabe4c2d0c634fc6d46e0e2f13107e7af23");
+    ok &= test_sha512_vector(256, long_msg,
+        "3928e184fb8690f840da3988121d31be65cb9d3ef83ee6146feac861e19b563a");
+
+    bool split_ok = test_streaming_split();
+    printf("ֿʽһ: %s\n", split_ok ? "ͨ" : "ʧ");
+    ok &= split_ok;
 
-    // 3. ַ
-    // : 248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1
-    test_sha256_vector("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "248D6A61...");
+    bench_hash();
 
-    return true; // 򵥷 trueʵӦ memcmp ֤
+    return ok;
 }
 
 extern "C" int test_hash_main() {
@@ -1,6 +1,7 @@
 #include "hmac.h"
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 bool test_hmac_rfc4231() {
     printf("===========================================\n");
@@ -43,8 +44,145 @@ bool test_hmac_rfc4231() {
     }
 }
 
+// ԤԿ: ͬһԿϢʽֿһ
+static bool test_hmac_cached_ctx() {
+    printf("\n===========================================\n");
+    printf("     ԤԿ HMAC_SHA256_CTX \n");
+    printf("===========================================\n");
+
+    uint8 key1[20], key6[131];
+    memset(key1, 0x0b, sizeof(key1));
+    memset(key6, 0xaa, sizeof(key6));
+    const char* msg1 = "Hi There";
+    const char* msg6 = "Test Using Larger Than Block-Size Key - Hash Key First";
+
+    uint8 expected[HMAC_OUTPUT_SIZE], output[HMAC_OUTPUT_SIZE];
+    HMAC_SHA256_CTX ctx;
+    bool ok = true;
+
+    // RFC 4231 Test Case 1: ͬһΣͬ
+    hex_to_bytes("b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7", expected, HMAC_OUTPUT_SIZE);
+    hmac_sha256_set_key(&ctx, key1, sizeof(key1));
+    for (int round = 0; round < 2; round++) {
+        hmac_sha256_init(&ctx);
+        hmac_sha256_update(&ctx, (const uint8*)msg1, strlen(msg1));
+        hmac_sha256_final(&ctx, output);
+        ok &= memcmp(output, expected, HMAC_OUTPUT_SIZE) == 0;
+    }
+    printf("[1] RFC 4231 TC1 (Կ): %s\n", ok ? "ͨ" : "ʧ");
+
+    // RFC 4231 Test Case 6: 鳤Կ + ֿʽ
+    hex_to_bytes("60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54", expected, HMAC_OUTPUT_SIZE);
+    hmac_sha256_set_key(&ctx, key6, sizeof(key6));
+    hmac_sha256_init(&ctx);
+    hmac_sha256_update(&ctx, (const uint8*)msg6, 10);
+    hmac_sha256_update(&ctx, (const uint8*)msg6 + 10, strlen(msg6) - 10);
+    hmac_sha256_final(&ctx, output);
+    bool ok6 = memcmp(output, expected, HMAC_OUTPUT_SIZE) == 0;
+    printf("[2] RFC 4231 TC6 (Կ, ֿ): %s\n", ok6 ? "ͨ" : "ʧ");
+    ok &= ok6;
+
+    // HMAC-SHA512: RFC 4231 Test Case 2
+    uint8 expected512[HMAC_SHA512_OUTPUT_SIZE], output512[HMAC_SHA512_OUTPUT_SIZE];
+    hex_to_bytes("164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea250554"
+        "9758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737", expected512, HMAC_SHA512_OUTPUT_SIZE);
+    hmac_sha512((const uint8*)"Jefe", 4, (const uint8*)"what do ya want for nothing?", 28, output512);
+    bool ok512 = memcmp(output512, expected512, HMAC_SHA512_OUTPUT_SIZE) == 0;
+    printf("[3] HMAC-SHA512 RFC 4231 TC2: %s\n", ok512 ? "ͨ" : "ʧ");
+    ok &= ok512;
+
+    // ܶԱ: Ϣʱÿ pad 븴м״̬
+    const int N = 200000;
+    uint8 msg[32] = { 0 };
+    clock_t t0 = clock();
+    for (int i = 0; i < N; i++) {
+        msg[0] = (uint8)i;
+        hmac_sha256(key1, sizeof(key1), msg, sizeof(msg), output);
+    }
+    double t_plain = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    hmac_sha256_set_key(&ctx, key1, sizeof(key1));
+    for (int i = 0; i < N; i++) {
+        msg[0] = (uint8)i;
+        hmac_sha256_init(&ctx);
+        hmac_sha256_update(&ctx, msg, sizeof(msg));
+        hmac_sha256_final(&ctx, output);
+    }
+    double t_cached = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] %d  32 ֽϢ HMAC:\n", N);
+    if (t_plain > 0) printf("    hmac_sha256 (ÿ pad): %.0f /\n", N / t_plain);
+    if (t_cached > 0) printf("    HMAC_SHA256_CTX (м״̬): %.0f /\n", N / t_cached);
+
+    return ok;
+}
+
+// ֤: λͼ֤һ£۸ĵĿ뱻ʶ
+static bool test_hmac_verify_batch() {
+    printf("\n===========================================\n");
+    printf("       HMAC-SHA256 ֤\n");
+    printf("===========================================\n");
+
+    const size_t N = 300;
+    static uint8 msgs[300][200];
+    static uint8 tags[300][HMAC_OUTPUT_SIZE];
+    static HMAC_SHA256_VERIFY_ITEM items[300];
+    uint8 bitmap[(300 + 7) / 8];
+    HMAC_SHA256_CTX keys[3];
+    const char* key_str[3] = { "gateway-key-A", "gateway-key-B", "a-much-longer-gateway-key-that-exceeds-the-sha256-block-size-0123456789" };
+    size_t expected_pass = 0;
+
+    for (int k = 0; k < 3; k++) {
+        hmac_sha256_set_key(&keys[k], (const uint8*)key_str[k], strlen(key_str[k]));
+    }
+
+    // Ŀ:  0 ~ 199  ( 1  / 2 )ÿ 7 ۸һ
+    for (size_t i = 0; i < N; i++) {
+        size_t len = (i * 37) % 200;
+        for (size_t j = 0; j < len; j++) msgs[i][j] = (uint8)(i + j * 13);
+        hmac_sha256((const uint8*)key_str[i % 3], strlen(key_str[i % 3]), msgs[i], len, tags[i]);
+        if (i % 7 == 3) tags[i][i % HMAC_OUTPUT_SIZE] ^= 0x01;
+        else expected_pass++;
+
+        items[i].key = &keys[i % 3];
+        items[i].msg = msgs[i];
+        items[i].msg_len = len;
+        items[i].tag = tags[i];
+    }
+
+    size_t passed = hmac_sha256_verify_batch(items, N, bitmap);
+    bool ok = (passed == expected_pass);
+    for (size_t i = 0; i < N; i++) {
+        bool bit = (bitmap[i / 8] >> (i % 8)) & 1;
+        bool single = hmac_sha256_verify(items[i].key, items[i].msg, items[i].msg_len, items[i].tag);
+        if (bit != single || bit != (i % 7 != 3)) ok = false;
+    }
+    printf("[1] %zu ͨ %zu  ( %zu)λͼ֤һ: %s\n",
+        N, passed, expected_pass, ok ? "" : "");
+
+    // ܶԱ: ֤֤
+    const int ROUNDS = 500;
+    clock_t t0 = clock();
+    for (int r = 0; r < ROUNDS; r++)
+        for (size_t i = 0; i < N; i++)
+            hmac_sha256_verify(items[i].key, items[i].msg, items[i].msg_len, items[i].tag);
+    double t_single = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    for (int r = 0; r < ROUNDS; r++)
+        hmac_sha256_verify_batch(items, N, bitmap);
+    double t_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] %d ֤:\n", (int)(ROUNDS * N));
+    if (t_single > 0) printf("     hmac_sha256_verify: %.0f /\n", ROUNDS * N / t_single);
+    if (t_batch > 0) printf("    hmac_sha256_verify_batch: %.0f /\n", ROUNDS * N / t_batch);
+
+    return ok;
+}
+
 extern "C" int test_hmac_main() {
-    if (test_hmac_rfc4231()) {
+    if (test_hmac_rfc4231() && test_hmac_cached_ctx() && test_hmac_verify_batch()) {
         return 0;
     }
     return 1;
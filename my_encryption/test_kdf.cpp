@@ -0,0 +1,202 @@
+#include "kdf.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// ʵ: ֱ hmac_sha256 ϰ (ÿε 4 ѹ)
+static void pbkdf2_reference(const uint8* pw, size_t pw_len, const uint8* salt, size_t salt_len,
+    uint32 iterations, uint8* out, size_t out_len) {
+    uint8 buf[256];
+    uint8 u[HMAC_OUTPUT_SIZE], t[HMAC_OUTPUT_SIZE];
+    for (uint32 i = 1; (size_t)(i - 1) * HMAC_OUTPUT_SIZE < out_len; i++) {
+        memcpy(buf, salt, salt_len);
+        buf[salt_len] = (uint8)(i >> 24); buf[salt_len + 1] = (uint8)(i >> 16);
+        buf[salt_len + 2] = (uint8)(i >> 8); buf[salt_len + 3] = (uint8)i;
+        hmac_sha256(pw, pw_len, buf, salt_len + 4, u);
+        memcpy(t, u, HMAC_OUTPUT_SIZE);
+        for (uint32 j = 1; j < iterations; j++) {
+            hmac_sha256(pw, pw_len, u, HMAC_OUTPUT_SIZE, u);
+            for (int k = 0; k < HMAC_OUTPUT_SIZE; k++) t[k] ^= u[k];
+        }
+        size_t pos = (size_t)(i - 1) * HMAC_OUTPUT_SIZE;
+        size_t n = (out_len - pos < HMAC_OUTPUT_SIZE) ? out_len - pos : HMAC_OUTPUT_SIZE;
+        memcpy(out + pos, t, n);
+    }
+}
+
+static bool check_pbkdf2(const char* pw, const char* salt, uint32 c, size_t dk_len, const char* expected_hex) {
+    uint8 dk[64], expected[64];
+    pbkdf2_hmac_sha256((const uint8*)pw, strlen(pw), (const uint8*)salt, strlen(salt), c, dk, dk_len);
+    hex_to_bytes(expected_hex, expected, dk_len);
+    bool ok = memcmp(dk, expected, dk_len) == 0;
+    printf("    P=\"%s\", S=\"%.12s%s\", c=%u, dkLen=%zu: %s\n",
+        pw, salt, strlen(salt) > 12 ? "..." : "", c, dk_len, ok ? "ͨ" : "ʧ");
+    if (!ok) print_hex("    ʵ", dk, dk_len);
+    return ok;
+}
+
+bool test_pbkdf2() {
+    printf("===========================================\n");
+    printf("        PBKDF2-HMAC-SHA256 \n");
+    printf("===========================================\n");
+
+    bool ok = true;
+    printf("[1] ׼ (RFC 7914 / RFC 6070 ):\n");
+    ok &= check_pbkdf2("password", "salt", 1, 32,
+        "120fb6cffcf8b32c43e7225256c4f837a86548c92ccc35480805987cb70be17b");
+    ok &= check_pbkdf2("password", "salt", 4096, 32,
+        "c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134a");
+    ok &= check_pbkdf2("passwd", "salt", 1, 64,
+        "55ac046e56e3089fec1691c22544b605f94185216dde0465e68b9d57c20dacbc"
+        "49ca9cccf179b645991664b39d77ef317c71b845b1e30bd509112041d3a19783");
+    ok &= check_pbkdf2("passwordPASSWORDpassword", "saltSALTsaltSALTsaltSALTsaltSALTsalt", 4096, 40,
+        "348c89dbcbd32b2f32d814b8116e84cf2b17347ebc1800181c4e2a1fb8dd53e1c635518c7dac47e9");
+
+    //  SHA256_LANES  (鲢) ʱʵһ
+    uint8 dk[300], ref[300];
+    const uint8 pw[] = "correct horse battery staple";
+    const uint8 salt[] = "per-user-salt";
+    pbkdf2_hmac_sha256(pw, sizeof(pw) - 1, salt, sizeof(salt) - 1, 100, dk, sizeof(dk));
+    pbkdf2_reference(pw, sizeof(pw) - 1, salt, sizeof(salt) - 1, 100, ref, sizeof(ref));
+    bool long_ok = memcmp(dk, ref, sizeof(dk)) == 0;
+    printf("[2] 300 ֽ (10 ) ʵһ: %s\n", long_ok ? "ͨ" : "ʧ");
+    ok &= long_ok;
+
+    // : ÿ (ֻռһ·; 8 ռ·)
+    const uint32 ITER = 20000;
+    clock_t t0 = clock();
+    pbkdf2_reference(pw, sizeof(pw) - 1, salt, sizeof(salt) - 1, ITER, ref, 32);
+    double t_ref = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    pbkdf2_hmac_sha256(pw, sizeof(pw) - 1, salt, sizeof(salt) - 1, ITER, dk, 32);
+    double t_one = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    pbkdf2_hmac_sha256(pw, sizeof(pw) - 1, salt, sizeof(salt) - 1, ITER, dk, 32 * SHA256_LANES);
+    double t_lanes = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] c = %u:\n", ITER);
+    if (t_ref > 0) printf("     hmac_sha256 ʵ (32 ֽ): %.0f /\n", ITER / t_ref);
+    if (t_one > 0) printf("    pbkdf2_hmac_sha256 (32 ֽ):          %.0f /\n", ITER / t_one);
+    if (t_lanes > 0) printf("    pbkdf2_hmac_sha256 (%d ֽ, %d ·):    %.0f /\n",
+        32 * SHA256_LANES, SHA256_LANES, (double)ITER * SHA256_LANES / t_lanes);
+
+    return ok;
+}
+
+static bool check_bytes(const char* label, const uint8* actual, const char* expected_hex, size_t len) {
+    uint8 expected[128];
+    hex_to_bytes(expected_hex, expected, len);
+    bool ok = memcmp(actual, expected, len) == 0;
+    printf("    %s: %s\n", label, ok ? "ͨ" : "ʧ");
+    if (!ok) print_hex("    ʵ", actual, len);
+    return ok;
+}
+
+bool test_hkdf() {
+    printf("\n===========================================\n");
+    printf("        HKDF-SHA256 / HKDF-SHA512 \n");
+    printf("===========================================\n");
+
+    bool ok = true;
+    uint8 ikm[22], salt[13], info[10];
+    uint8 prk[SHA512_BLOCK_SIZE], okm[100];
+    memset(ikm, 0x0b, sizeof(ikm));
+    for (int i = 0; i < 13; i++) salt[i] = (uint8)i;
+    for (int i = 0; i < 10; i++) info[i] = (uint8)(0xf0 + i);
+
+    printf("[1] RFC 5869 :\n");
+    // Test Case 1
+    hkdf_sha256_extract(salt, sizeof(salt), ikm, sizeof(ikm), prk);
+    ok &= check_bytes("TC1 PRK", prk, "077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5", 32);
+    hkdf_sha256(salt, sizeof(salt), ikm, sizeof(ikm), info, sizeof(info), okm, 42);
+    ok &= check_bytes("TC1 OKM", okm, "3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865", 42);
+    // Test Case 3: Ρ info
+    hkdf_sha256(NULL, 0, ikm, sizeof(ikm), NULL, 0, okm, 42);
+    ok &= check_bytes("TC3 OKM", okm, "8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d9d201395faa4b61a96c8", 42);
+
+    printf("[2] HKDF-SHA512:\n");
+    hkdf_sha512(salt, sizeof(salt), ikm, sizeof(ikm), info, sizeof(info), okm, 42);
+    ok &= check_bytes("TC1  OKM", okm, "832390086cda71fb47625bb5ceb168e4c8e26a1a16ed34d9fc7fe92c1481579338da362cb8d9f925d7cb", 42);
+    hkdf_sha512(NULL, 0, ikm, sizeof(ikm), NULL, 0, okm, 100);
+    ok &= check_bytes(" 100 ֽ OKM", okm,
+        "f5fa02b18298a72a8c23898a8703472c6eb179dc204c03425c970e3b164bf90f"
+        "ff22d04836d0e2343bacc4e7cb6045faaa698e0e3b3eb91331306def1db8319e"
+        "8a699b5ee45ab993847dc4df75bde023692c8c0710a67a55123f10a8b2d8327f"
+        "9eb138da", 100);
+
+    // [3] :  expand Ľһ (ͬȡһıǩ)
+    const size_t N = 40;
+    static uint8 batch_out[40][80], single_out[40][80];
+    static char names[40][24];
+    HKDF_LABEL labels[40];
+    HMAC_SHA256_CTX prk256;
+    HMAC_SHA512_CTX prk512;
+
+    hkdf_sha256_extract(salt, sizeof(salt), ikm, sizeof(ikm), prk);
+    hmac_sha256_set_key(&prk256, prk, SHA256_BLOCK_SIZE);
+    for (size_t i = 0; i < N; i++) {
+        size_t len = 0;
+        const char* prefix = (i % 2) ? "server traffic key " : "client traffic key ";
+        while (prefix[len]) { names[i][len] = prefix[len]; len++; }
+        names[i][len++] = (char)('A' + i % 26);
+        labels[i].info = (const uint8*)names[i];
+        labels[i].info_len = len;
+        labels[i].okm = batch_out[i];
+        labels[i].okm_len = 16 + (i * 7) % 65;
+    }
+    bool batch_ok = hkdf_sha256_expand_labels(&prk256, labels, N);
+    for (size_t i = 0; i < N; i++) {
+        hkdf_sha256_expand(&prk256, labels[i].info, labels[i].info_len, single_out[i], labels[i].okm_len);
+        if (memcmp(batch_out[i], single_out[i], labels[i].okm_len) != 0) batch_ok = false;
+    }
+    printf("[3] %zu ǩ (SHA-256) һ: %s\n", N, batch_ok ? "ͨ" : "ʧ");
+    ok &= batch_ok;
+
+    hkdf_sha512_extract(salt, sizeof(salt), ikm, sizeof(ikm), prk);
+    hmac_sha512_set_key(&prk512, prk, SHA512_BLOCK_SIZE);
+    batch_ok = hkdf_sha512_expand_labels(&prk512, labels, N);
+    for (size_t i = 0; i < N; i++) {
+        hkdf_sha512_expand(&prk512, labels[i].info, labels[i].info_len, single_out[i], labels[i].okm_len);
+        if (memcmp(batch_out[i], single_out[i], labels[i].okm_len) != 0) batch_ok = false;
+    }
+    printf("    %zu ǩ (SHA-512) һ: %s\n", N, batch_ok ? "ͨ" : "ʧ");
+    ok &= batch_ok;
+
+    // 뱻ܾ
+    uint8 dummy[1];
+    bool reject = !hkdf_sha256_expand(&prk256, NULL, 0, dummy, 255 * SHA256_BLOCK_SIZE + 1);
+    printf("[4] ܾ 255 * HashLen : %s\n", reject ? "ͨ" : "ʧ");
+    ok &= reject;
+
+    // : Ựʱͬһ PRK һԿ
+    const int ROUNDS = 20000;
+    clock_t t0 = clock();
+    for (int r = 0; r < ROUNDS; r++)
+        for (size_t i = 0; i < 8; i++)
+            hkdf_sha256(salt, sizeof(salt), ikm, sizeof(ikm), labels[i].info, labels[i].info_len, single_out[i], 32);
+    double t_naive = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (size_t i = 0; i < 8; i++) labels[i].okm_len = 32;
+        hkdf_sha256_extract(salt, sizeof(salt), ikm, sizeof(ikm), prk);
+        hmac_sha256_set_key(&prk256, prk, SHA256_BLOCK_SIZE);
+        hkdf_sha256_expand_labels(&prk256, labels, 8);
+    }
+    double t_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] ÿλỰ 8  32 ֽԿ:\n");
+    if (t_naive > 0) printf("     hkdf_sha256:      %.0f Ự/\n", ROUNDS / t_naive);
+    if (t_batch > 0) printf("    extract + expand_labels:   %.0f Ự/\n", ROUNDS / t_batch);
+
+    return ok;
+}
+
+extern "C" int test_kdf_main() {
+    bool pbkdf2_ok = test_pbkdf2();
+    bool hkdf_ok = test_hkdf();
+    if (pbkdf2_ok && hkdf_ok) return 0;
+    return 1;
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "nonce.h"
+#include "elgamal.h"
+#include <stdio.h>
+#include <time.h>
+#include <chrono>
+#include <thread>
+
+// ȴ̨̰߳ѳ target  ( timeout_ms )
+static bool wait_for_pool(NONCE_POOL* pool, size_t target, int timeout_ms) {
+    NONCE_POOL_STATS st;
+    for (int waited = 0; waited <= timeout_ms; waited += 5) {
+        nonce_pool_get_stats(pool, &st);
+        if (st.available >= target) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+
+// 62 λ p / 32 λ q  DSA  ( test_dsa ͬ)
+static const uint64 DSA_P = 2305843152558227287ULL;
+static const uint64 DSA_Q = 4294967291ULL;
+static const uint64 DSA_G = 825429179120524832ULL;
+
+bool test_nonce_dsa() {
+    printf("===========================================\n");
+    printf("       ǩز (DSA / ElGamal / ECDSA)\n");
+    printf("===========================================\n");
+
+    DSA_PublicKey pub;
+    DSA_PrivateKey priv;
+    if (!dsa_generate_keys(DSA_P, DSA_Q, DSA_G, 2718281828ULL, &pub, &priv)) return false;
+
+    NONCE_POOL* pool = nonce_pool_create_dsa(&priv.params, 64, 2);
+    if (!pool) return false;
+    bool passed = wait_for_pool(pool, 64, 5000);
+
+    NONCE_TRIPLE t;
+    for (int i = 0; i < 1000 && passed; i++) {
+        uint64 digest = (uint64)i * 0x9E3779B97F4A7C15ULL;
+        nonce_pool_pop(pool, &t);
+        DSA_Signature sig = dsa_sign_with_nonce(digest, &t, &priv);
+        // ͬһ k  dsa_sign Ľȫͬ
+        DSA_Signature ref = dsa_sign(digest, t.k, &priv);
+        if (sig.r != ref.r || sig.s != ref.s || !dsa_verify(digest, sig, &pub)) {
+            printf("[DSA] ?  %d ǩ\n", i);
+            passed = false;
+        }
+    }
+
+    NONCE_POOL_STATS st;
+    nonce_pool_get_stats(pool, &st);
+    printf("[DSA] 1000 ǩ: ȡ %llu Σؿ %llu Σ̨ %llu \n",
+        st.pops - st.empty, st.empty, st.produced);
+
+    // Ϊ 0 ʱÿζǳؿգغ²
+    nonce_pool_set_depth(pool, 0);
+    uint64 empty_before = st.empty;
+    for (int i = 0; i < 10; i++) nonce_pool_pop(pool, &t);
+    nonce_pool_get_stats(pool, &st);
+    if (st.empty - empty_before != 10 || st.depth != 0) {
+        printf("[DSA] ? Ϊ 0 ʱؿռ\n");
+        passed = false;
+    }
+    nonce_pool_set_depth(pool, 16);
+    if (!wait_for_pool(pool, 16, 5000)) passed = false;
+    nonce_pool_destroy(pool);
+
+    if (passed) printf("[DSA] ? ǩȫͨǩȵؿͳȷ\n");
+    return passed;
+}
+
+bool test_nonce_elgamal_ecdsa() {
+    bool passed = true;
+    NONCE_TRIPLE t;
+
+    // ElGamal: ذԿ g  r g  2
+    const uint64 p = 4294967291ULL, g = 5;
+    ElGamal_PublicKey epub;
+    ElGamal_PrivateKey epriv;
+    elgamal_generate_keys(p, g, 1234567891ULL, &epub, &epriv);
+    NONCE_POOL* pool = nonce_pool_create_elgamal(p, g, 32, 1);
+    ElGamal_Signature sig;
+    for (int i = 0; i < 500 && pool; i++) {
+        uint64 m = (uint64)i * 2654435761u % (p - 1);
+        do {
+            nonce_pool_pop(pool, &t);
+            sig = elgamal_sign_with_nonce(m, &t, &epriv);
+        } while (sig.s == 0);
+        if (!elgamal_verify(m, sig, &epub) || elgamal_verify(m + 1, sig, &epub)) {
+            printf("[ElGamal] ?  %d ǩ\n", i);
+            passed = false;
+            break;
+        }
+    }
+
+    // M = x * r (mod p - 1) ʱ s = 0: ǩϣһԪǩ
+    if (pool && passed) {
+        nonce_pool_pop(pool, &t);
+        uint64 m = mul_mod(epriv.x, t.r, p - 1);
+        sig = elgamal_sign_with_nonce(m, &t, &epriv);
+        if (sig.r != 0 || sig.s != 0 || elgamal_verify(m, sig, &epub)) {
+            printf("[ElGamal] ? s = 0 ǩδ\n");
+            passed = false;
+        }
+        nonce_pool_pop(pool, &t);
+        sig = elgamal_sign_with_nonce(m, &t, &epriv);
+        if (sig.s == 0 || !elgamal_verify(m, sig, &epub)) {
+            printf("[ElGamal] ? Ԫǩ\n");
+            passed = false;
+        }
+    }
+    nonce_pool_destroy(pool);
+    if (!pool) return false;
+    if (passed) printf("[ElGamal] ? 500 ǩȫͨǩ (g = %llu)s = 0 ʱǩ\n", g);
+
+    // ECDSA: test_ecc еĽѧ y^2 = x^3 + 2x + 2 (mod 17)G = (5, 1)n = 19
+    ECC_Curve curve = { 17, 2, 2, 19 };
+    ECC_Point G = { 5, 1, false };
+    ECC_PublicKey cpub;
+    ECC_PrivateKey cpriv;
+    if (!ecc_generate_keys(curve, G, 7, &cpub, &cpriv)) return false;
+    pool = nonce_pool_create_ecdsa(&curve, G, 8, 1);
+    if (!pool) return false;
+    int good = 0;
+    for (uint64 hash = 0; hash < 200; hash++) {
+        nonce_pool_pop(pool, &t);
+        // С hash + r*d  0 (mod n)  s = 0 ĸʲɺԣһϢ
+        if ((hash + t.r * cpriv.d) % curve.n == 0) continue;
+        ECC_Signature sig = ecdsa_sign_with_nonce(hash, &t, &cpriv);
+        if (!ecdsa_verify(hash, sig, &cpub)) {
+            printf("[ECDSA] ? hash=%llu ǩ֤ʧ\n", hash);
+            passed = false;
+            break;
+        }
+        good++;
+    }
+    nonce_pool_destroy(pool);
+    if (passed) printf("[ECDSA] ? %d ǩȫͨǩ\n", good);
+    return passed;
+}
+
+// : ֳǩ vs ԤĳȡԪǩ
+bool test_nonce_bench() {
+    DSA_PublicKey pub;
+    DSA_PrivateKey priv;
+    if (!dsa_generate_keys(DSA_P, DSA_Q, DSA_G, 2718281828ULL, &pub, &priv)) return false;
+
+    const int N = 20000;
+    NONCE_POOL* pool = nonce_pool_create_dsa(&priv.params, N, 1);
+    if (!pool) return false;
+    bool filled = wait_for_pool(pool, N, 10000);
+
+    uint64 acc = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < N; i++) {
+        uint64 k = random_uint64() % (DSA_Q - 1) + 1;
+        acc += dsa_sign((uint64)i, k, &priv).s;
+    }
+    double t_inline = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    NONCE_TRIPLE t;
+    t0 = clock();
+    for (int i = 0; i < N; i++) {
+        nonce_pool_pop(pool, &t);
+        acc += dsa_sign_with_nonce((uint64)i, &t, &priv).s;
+    }
+    double t_pool = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    NONCE_POOL_STATS st;
+    nonce_pool_get_stats(pool, &st);
+    nonce_pool_destroy(pool);
+
+    printf("\n[] %d  DSA ǩ (p Ϊ 62 λ):\n", N);
+    if (t_inline > 0) printf("    ֳ k:     %.0f /\n", N / t_inline);
+    if (t_pool > 0) printf("    ȡԪ: %.0f / (ؿ %llu )\n", N / t_pool, st.empty);
+    (void)acc;
+    return filled;
+}
+
+// 
+extern "C" int test_nonce_main() {
+    if (test_nonce_dsa() && test_nonce_elgamal_ecdsa() && test_nonce_bench()) {
+        return 0;
+    }
+    return 1;
+}
\ No newline at end of file
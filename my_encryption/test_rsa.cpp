@@ -1,5 +1,8 @@
 #include "rsa.h"
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
 
 // ӡ
 void print_rsa_key(const char* label, uint64 n, uint64 exp) {
@@ -91,12 +94,362 @@ bool test_rsa_full() {
         return false;
     }
 
+    // ---  D: CRT ˽Կ ---
+    printf("\n[ D] CRT ˽Կ:\n");
+    printf("    CRT : dP=%llu, dQ=%llu, qInv=%llu\n", priv.dP, priv.dQ, priv.qInv);
+
+    // ֻ (d, n) ľʽ˽Կڶ
+    RSA_PrivateKey plain_priv = {};
+    plain_priv.d = priv.d;
+    plain_priv.n = priv.n;
+
+    for (uint64 m = 0; m < pub.n; m++) {
+        uint64 c = rsa_encrypt(m, &pub);
+        if (rsa_decrypt(c, &priv) != m || rsa_decrypt(c, &plain_priv) != m) {
+            printf("    ? CRT ܽ (m=%llu)\n", m);
+            return false;
+        }
+    }
+    printf("    ? ȫ %llu : CRT  c^d mod n һ\n", pub.n);
+
+    return true;
+}
+
+// CRT ܶԱ: ϴ (n Լ 31 λ)
+bool test_rsa_crt_bench() {
+    RSA_PublicKey pub;
+    RSA_PrivateKey priv, plain_priv = {};
+    if (!rsa_generate_keys(50021, 50023, 65537, &pub, &priv)) return false;
+    plain_priv.d = priv.d;
+    plain_priv.n = priv.n;
+
+    const int N = 200000;
+    uint64 acc1 = 0, acc2 = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < N; i++) acc1 += rsa_decrypt((uint64)i * 7919 % pub.n, &plain_priv);
+    double t_plain = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    for (int i = 0; i < N; i++) acc2 += rsa_decrypt((uint64)i * 7919 % pub.n, &priv);
+    double t_crt = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] %d ˽Կ (n=%llu):\n", N, pub.n);
+    if (t_plain > 0) printf("    c^d mod n: %.0f /\n", N / t_plain);
+    if (t_crt > 0) printf("    CRT:       %.0f /\n", N / t_crt);
+    return acc1 == acc2;
+}
+
+// ǩ/ǩ:  rsa_sign / rsa_verify ȫһ
+bool test_rsa_batch() {
+    printf("\n[ E] ǩ/ǩ:\n");
+
+    // e = 17 ͨǩ·e = 3 / 65537 ߿·
+    const uint64 keys[][3] = { { 61, 53, 17 }, { 50021, 50023, 65537 }, { 50021, 50033, 3 } };
+    const size_t N = 1000;
+    uint64* msgs = new uint64[N];
+    uint64* sigs = new uint64[N];
+    bool* ok = new bool[N];
+    bool passed = true;
+
+    for (size_t k = 0; k < sizeof(keys) / sizeof(keys[0]) && passed; k++) {
+        RSA_PublicKey pub;
+        RSA_PrivateKey priv;
+        RSA_BATCH_CTX ctx;
+        // e = 3 Ҫ gcd(3, phi) = 1Ե黻 q
+        if (!rsa_generate_keys(keys[k][0], keys[k][1], keys[k][2], &pub, &priv) || !rsa_batch_init(&ctx, &priv)) {
+            passed = false;
+            break;
+        }
+
+        for (size_t i = 0; i < N; i++) msgs[i] = (i * 2654435761u + 12345) % pub.n;
+
+        // ߳ (N >= 256) 뵥̸߳һ
+        for (int threads = 0; threads <= 1 && passed; threads++) {
+            rsa_sign_batch(&ctx, msgs, sigs, N, threads);
+            for (size_t i = 0; i < N; i++) {
+                if (sigs[i] != rsa_sign(msgs[i], &priv)) {
+                    printf("    ? ǩ rsa_sign һ (n=%llu, i=%zu)\n", pub.n, i);
+                    passed = false;
+                    break;
+                }
+            }
+        }
+        if (!passed) break;
+
+        if (rsa_verify_batch(&pub, sigs, msgs, ok, N, 0) != N) {
+            printf("    ? ǩδȫͨ (n=%llu, e=%llu)\n", pub.n, pub.e);
+            passed = false;
+            break;
+        }
+
+        // ۸ǩӦǡñܾ
+        sigs[7] = (sigs[7] + 1) % pub.n;
+        sigs[N - 1] = (sigs[N - 1] + 1) % pub.n;
+        if (rsa_verify_batch(&pub, sigs, msgs, ok, N, 0) != N - 2 || ok[7] || ok[N - 1] || !ok[8]) {
+            printf("    ? ǩδ۸ (n=%llu, e=%llu)\n", pub.n, pub.e);
+            passed = false;
+            break;
+        }
+        printf("    ? n=%llu, e=%llu: %zu ǩһ£۸ı\n", pub.n, pub.e, N);
+    }
+
+    delete[] msgs;
+    delete[] sigs;
+    delete[] ok;
+    return passed;
+}
+
+//  parallel_for ڲٵǩ: ڲ parallel_for Ӧ͵شִУǵȴռõ̳߳
+typedef struct {
+    const RSA_BATCH_CTX* ctx;
+    const uint64* msgs;
+    uint64* sigs;
+    size_t per_job;
+} NESTED_SIGN_JOB;
+
+static void nested_sign_range(size_t begin, size_t end, void* arg) {
+    const NESTED_SIGN_JOB* job = (const NESTED_SIGN_JOB*)arg;
+    for (size_t j = begin; j < end; j++) {
+        rsa_sign_batch(job->ctx, job->msgs + j * job->per_job, job->sigs + j * job->per_job, job->per_job, 0);
+    }
+}
+
+bool test_parallel_nested() {
+    printf("\n[ E2] Ƕ parallel_for:\n");
+    RSA_PublicKey pub;
+    RSA_PrivateKey priv;
+    RSA_BATCH_CTX ctx;
+    if (!rsa_generate_keys(50021, 50023, 65537, &pub, &priv) || !rsa_batch_init(&ctx, &priv)) return false;
+
+    // ÿǩ 512  (ǩĲֵڲҲ parallel_for)
+    const size_t JOBS = 16, PER_JOB = 512, N = JOBS * PER_JOB;
+    uint64* msgs = new uint64[N];
+    uint64* sigs = new uint64[N];
+    for (size_t i = 0; i < N; i++) msgs[i] = (i * 2654435761u + 777) % pub.n;
+
+    NESTED_SIGN_JOB job;
+    job.ctx = &ctx;
+    job.msgs = msgs;
+    job.sigs = sigs;
+    job.per_job = PER_JOB;
+    parallel_for(JOBS, 0, nested_sign_range, &job);
+
+    bool passed = true;
+    for (size_t i = 0; i < N && passed; i++) passed = sigs[i] == rsa_sign(msgs[i], &priv);
+    if (passed) printf("    ? %zu ǩ %zu δҽ rsa_sign һ\n", JOBS, PER_JOB);
+    else printf("    ? Ƕǩ rsa_sign һ\n");
+
+    delete[] msgs;
+    delete[] sigs;
+    return passed;
+}
+
+// ǩܶԱ
+bool test_rsa_batch_bench() {
+    RSA_PublicKey pub;
+    RSA_PrivateKey priv;
+    RSA_BATCH_CTX ctx;
+    if (!rsa_generate_keys(50021, 50023, 65537, &pub, &priv) || !rsa_batch_init(&ctx, &priv)) return false;
+
+    const size_t N = 200000;
+    uint64* msgs = new uint64[N];
+    uint64* sigs = new uint64[N];
+    for (size_t i = 0; i < N; i++) msgs[i] = (uint64)i * 7919 % pub.n;
+
+    // clock() ڲƽ̨ͳƵȫ̵߳ CPU ʱ䣬ֻȽϵ߳
+    uint64 acc = 0;
+    clock_t t0 = clock();
+    for (size_t i = 0; i < N; i++) acc += rsa_sign(msgs[i], &priv);
+    double t_single = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    rsa_sign_batch(&ctx, msgs, sigs, N, 1);
+    double t_batch = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    uint64 acc_batch = 0;
+    for (size_t i = 0; i < N; i++) acc_batch += sigs[i];
+
+    t0 = clock();
+    size_t valid = rsa_verify_batch(&pub, sigs, msgs, NULL, N, 1);
+    double t_verify = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("\n[] %zu ǩ (n=%llu):\n", N, pub.n);
+    if (t_single > 0) printf("     rsa_sign:      %.0f /\n", N / t_single);
+    if (t_batch > 0) printf("    rsa_sign_batch:     %.0f / (߳)\n", N / t_batch);
+    if (t_verify > 0) printf("    rsa_verify_batch:   %.0f / (߳, e=65537)\n", N / t_verify);
+
+    delete[] msgs;
+    delete[] sigs;
+    return acc == acc_batch && valid == N;
+}
+
+// Կ: жģλӽӿһ
+bool test_rsa_keygen() {
+    printf("\n[ F] Կɲ:\n");
+
+    // Miller-Rabin : ֪Carmichael ǿα
+    const uint64 primes[] = { 2, 3, 65537, 2147483647ULL, 4294967291ULL, 18446744073709551557ULL };
+    const uint64 composites[] = { 1, 561, 1105, 3215031751ULL, 3825123056546413051ULL, 18446744073709551615ULL };
+    for (uint64 v : primes) {
+        if (!is_probable_prime(v)) { printf("    ? %llu ӦжΪ\n", v); return false; }
+    }
+    for (uint64 v : composites) {
+        if (is_probable_prime(v)) { printf("    ? %llu ӦжΪ\n", v); return false; }
+    }
+
+    const int sizes[] = { 20, 33, 48, 62 }; // e = 65537 Ҫ phi > eģ 18 λ
+    for (int bits : sizes) {
+        RSA_PublicKey pub;
+        RSA_PrivateKey priv;
+        RSA_BATCH_CTX ctx;
+        if (!rsa_generate_keypair(bits, 65537, &pub, &priv, 0)) return false;
+
+        int n_bits = 0;
+        while (pub.n >> n_bits) n_bits++;
+        if (n_bits != bits || !is_probable_prime(priv.p) || !is_probable_prime(priv.q) || priv.p == priv.q) {
+            printf("    ? %d λԿ (n=%llu)\n", bits, pub.n);
+            return false;
+        }
+
+        // ģ power()  128 λģˣӽܡǩӿڱһ
+        if (!rsa_batch_init(&ctx, &priv)) return false;
+        for (uint64 i = 1; i <= 64; i++) {
+            uint64 m = (i * 0x9E3779B97F4A7C15ULL) % pub.n;
+            uint64 s, c = rsa_encrypt(m, &pub);
+            rsa_sign_batch(&ctx, &m, &s, 1, 1);
+            if (rsa_decrypt(c, &priv) != m || rsa_verify(s, &pub) != m || s != rsa_sign(m, &priv)) {
+                printf("    ? %d λԿ (m=%llu)\n", bits, m);
+                return false;
+            }
+        }
+        printf("    ? %d λ: p=%llu, q=%llu, n=%llu\n", bits, priv.p, priv.q, pub.n);
+    }
+
+    // e СڿܵС phi ʱֱӾܾ; Χûкϸʱ޴ں󷵻 0
+    RSA_PublicKey pub;
+    RSA_PrivateKey priv;
+    if (rsa_generate_keypair(16, 65537, &pub, &priv, 0) || !rsa_generate_keypair(17, 65537, &pub, &priv, 0)) {
+        printf("    ? e = 65537 ʱ 16 λӦܾ17 λӦ\n");
+        return false;
+    }
+    if (generate_prime(3, 3, 0) != 0 || generate_prime(20, 2, 0) != 0) {
+        printf("    ? ںϸʱ generate_prime δ 0\n");
+        return false;
+    }
+    printf("    ?  e ܾ޽\n");
+    return true;
+}
+
+// Կ: ߳ȫ
+bool test_rsa_keygen_bench() {
+    const int N = 200;
+    RSA_PublicKey pub;
+    RSA_PrivateKey priv;
+
+    printf("\n[]  %d  62 λԿ:\n", N);
+    for (int threads = 1; threads >= 0; threads--) {
+        // ߳ʱ clock() ۼ̵߳ CPU ʱ䣬ǽʱ
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < N; i++) {
+            if (!rsa_generate_keypair(62, 65537, &pub, &priv, threads)) return false;
+        }
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        if (t > 0) printf("    %s: %.0f /\n", threads == 1 ? "߳  " : "ȫ", N / t);
+    }
+    return true;
+}
+
+// OAEP / PSS : ղοʵֵĹ̶۸ļ
+// (ģ 1024 λ: OAEP k = 128 ֽ, PSS emBits = 1023)
+bool test_rsa_padding() {
+    printf("\n[ G] OAEP / PSS :\n");
+    const size_t k = 128;
+    uint8 em[128], expected[128], seed[RSA_PAD_HASH_LEN], salt[32], mhash[RSA_PAD_HASH_LEN];
+    uint8 out[128];
+    size_t out_len;
+
+    // --- OAEP (seed = 00 01 .. 1f, ձǩ) ---
+    const char* msg = "hello OAEP";
+    size_t msg_len = strlen(msg);
+    for (int i = 0; i < 32; i++) seed[i] = (uint8)i;
+    hex_to_bytes("00558c1cc61f0348e691dabc958d8b6b5a7881ab4feb38fc7ec797e9be0b150a"
+                 "769344c47fca4af717407eda5bbc04e0a2927ac9d4fc20ea3f18c681d71e31c2"
+                 "d104a6950a06d3e3308ad7d3606ef810eb124e3943404ca746a12c51c7bf7768"
+                 "390f8d842ac9cb62349779a7537a78327d545aaeb33a4527abbdb316cfe5f766", expected, k);
+    if (!rsa_oaep_encode((const uint8*)msg, msg_len, NULL, 0, seed, em, k) || memcmp(em, expected, k) != 0) {
+        printf("    ? OAEP οһ\n");
+        return false;
+    }
+    out_len = sizeof(out);
+    if (!rsa_oaep_decode(em, k, NULL, 0, out, &out_len) || out_len != msg_len || memcmp(out, msg, msg_len) != 0) {
+        printf("    ? OAEP ʧ\n");
+        return false;
+    }
+    // ۸ġǩϢ뱻ܾ
+    memcpy(em, expected, k);
+    em[100] ^= 0x01;
+    out_len = sizeof(out);
+    bool tampered = rsa_oaep_decode(em, k, NULL, 0, out, &out_len);
+    memcpy(em, expected, k);
+    out_len = sizeof(out);
+    bool wrong_label = rsa_oaep_decode(em, k, (const uint8*)"x", 1, out, &out_len);
+    bool too_long = rsa_oaep_encode(out, k - 2 * RSA_PAD_HASH_LEN - 1, NULL, 0, seed, em, k);
+    if (tampered || wrong_label || too_long) {
+        printf("    ? OAEP δܾǷ\n");
+        return false;
+    }
+    printf("    ? OAEP /οһ£۸ı\n");
+
+    // --- PSS (salt = 40 41 .. 5f, mHash = SHA-256("hello PSS")) ---
+    for (int i = 0; i < 32; i++) salt[i] = (uint8)(0x40 + i);
+    hex_to_bytes("024b090b554de883c50a3171fdfdf9be1de63dadafca0c97d132efe21b78ed05", mhash, RSA_PAD_HASH_LEN);
+    hex_to_bytes("0931b1f399c98ce4862f51651fe6c629f1a8a358bd36afd44c98b491d7b20eae"
+                 "c716215ee19eee1ad45a1624e8f1405ef3d745ce321e95b04b7b20f6028e909d"
+                 "a69620a525c3a4c497c5ce2d397af182335a074c38123c07ae84e47a83fe45cf"
+                 "31e07b056d6c5cbbbc905796a347ac0b623e4e97d4e0bbf404176d7a1c6de8bc", expected, k);
+    if (!rsa_pss_encode(mhash, salt, 32, 1023, em) || memcmp(em, expected, k) != 0) {
+        printf("    ? PSS οһ\n");
+        return false;
+    }
+    if (!rsa_pss_verify(mhash, em, 1023, 32)) {
+        printf("    ? PSS Уʧ\n");
+        return false;
+    }
+    memcpy(em, expected, k);
+    em[10] ^= 0x80;
+    bool bad_em = rsa_pss_verify(mhash, em, 1023, 32);
+    memcpy(em, expected, k);
+    mhash[0] ^= 0x01;
+    bool bad_hash = rsa_pss_verify(mhash, em, 1023, 32);
+    if (bad_em || bad_hash) {
+        printf("    ? PSS δܾ۸\n");
+        return false;
+    }
+    printf("    ? PSS /Уοһ£۸ı\n");
+
+    // 뿪
+    const int N = 100000;
+    clock_t t0 = clock();
+    for (int i = 0; i < N; i++) {
+        seed[0] = (uint8)i;
+        rsa_oaep_encode((const uint8*)msg, msg_len, NULL, 0, seed, em, k);
+    }
+    double t_oaep = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    t0 = clock();
+    for (int i = 0; i < N; i++) {
+        salt[0] = (uint8)i;
+        rsa_pss_encode(mhash, salt, 32, 1023, em);
+    }
+    double t_pss = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    printf("\n[] 1024 λ (޶ѷ):\n");
+    if (t_oaep > 0) printf("    OAEP: %.0f /\n", N / t_oaep);
+    if (t_pss > 0) printf("    PSS:  %.0f /\n", N / t_pss);
     return true;
 }
 
 // 
 extern "C" int test_rsa_main() {
-    if (test_rsa_full()) {
+    if (test_rsa_full() && test_rsa_crt_bench() && test_rsa_batch() && test_parallel_nested() && test_rsa_batch_bench() &&
+        test_rsa_keygen() && test_rsa_keygen_bench() && test_rsa_padding()) {
         return 0;
     }
     return 1;
@@ -1,10 +1,37 @@
 #include "utils.h"
 #include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 // 1. /ģ
 uint64 power(uint64 base, uint64 exponent, uint64 modulus) {
     uint64 result = 1;
     base %= modulus;
+    // ģ 32 λʱ base * base :
+    // ģ Montgomery ˷ (ÿһ 128 λ)żģ 128 λм mul_mod
+    if (modulus > 0xFFFFFFFFULL && (modulus & 1)) {
+        MONT_CTX mont;
+        mont_init(&mont, modulus);
+        return mont_power(base, exponent, &mont);
+    }
+    if (modulus > 0xFFFFFFFFULL) {
+        while (exponent > 0) {
+            if (exponent & 1) {
+                result = mul_mod(result, base, modulus);
+            }
+            exponent >>= 1;
+            base = mul_mod(base, base, modulus);
+        }
+        return result;
+    }
     while (exponent > 0) {
         if (exponent & 1) {
             result = (result * base) % modulus;
@@ -30,6 +57,19 @@ uint64 extended_gcd(uint64 a, uint64 b, int64* x, int64* y) {
 
 // 3. ģԪ
 uint64 mod_inverse(uint64 a, uint64 m) {
+    // m  2^63 ʱ int64 ϵ: ֻ a ϵÿģ m £ʼձ [0, m) 
+    if (m > 0x7FFFFFFFFFFFFFFFULL) {
+        uint64 r0 = m, r1 = a % m, t0 = 0, t1 = 1;
+        while (r1 != 0) {
+            uint64 q = r0 / r1, r2 = r0 - q * r1;
+            uint64 qt = mul_mod(q, t1, m);
+            uint64 t2 = (t0 >= qt) ? t0 - qt : t0 + (m - qt);
+            r0 = r1; r1 = r2;
+            t0 = t1; t1 = t2;
+        }
+        return (r0 == 1) ? t0 : 0;
+    }
+
     int64 x, y;
     uint64 g = extended_gcd(a, m, &x, &y);
     if (g != 1) { return 0; }
@@ -41,6 +81,558 @@ uint64 mod_inverse(uint64 a, uint64 m) {
     return (uint64)((x % m_signed + m_signed) % m_signed);
 }
 
+// --- 128 λ˷ ---
+//  a * b ĵ 64 λ 64 λд *hi
+static inline uint64 mul_64x64(uint64 a, uint64 b, uint64* hi) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = (unsigned __int128)a * b;
+    *hi = (uint64)(r >> 64);
+    return (uint64)r;
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, hi);
+#else
+    // ͨʵ:  32 λĴγ˷
+    uint64 a_lo = (uint32)a, a_hi = a >> 32;
+    uint64 b_lo = (uint32)b, b_hi = b >> 32;
+    uint64 p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo, p3 = a_hi * b_hi;
+    uint64 mid = (p0 >> 32) + (uint32)p1 + (uint32)p2;
+    *hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32)p0;
+#endif
+}
+
+// 4. 64 λģ
+uint64 mul_mod(uint64 a, uint64 b, uint64 m) {
+    // ӶС 2^32 ʱ˻ֱ
+    if (((a | b) >> 32) == 0) return (a * b) % m;
+#if defined(__SIZEOF_INT128__)
+    return (uint64)(((unsigned __int128)a * b) % m);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64 hi, lo = _umul128(a % m, b % m, &hi), rem;
+    _udiv128(hi, lo, m, &rem);
+    return rem;
+#else
+    // ͨʵ: λλ (a, b < m ʱκмֵ)
+    uint64 result = 0;
+    a %= m; b %= m;
+    while (b > 0) {
+        if (b & 1) result = (result >= m - a) ? result - (m - a) : result + a;
+        a = (a >= m - a) ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return result;
+#endif
+}
+
+uint64 add_mod(uint64 a, uint64 b, uint64 m) {
+    return (a >= m - b) ? a - (m - b) : a + b;
+}
+
+// --- Montgomery ģʵ ---
+
+void mont_init(MONT_CTX* ctx, uint64 n) {
+    ctx->n = n;
+
+    // ţٵ n^(-1) mod 2^64: ÿεЧλ (n Ϊʱֵ n  3 λȷ)
+    uint64 inv = n;
+    for (int i = 0; i < 5; i++) inv *= 2 - n * inv;
+    ctx->n_inv = inv;
+
+    // R mod n = (2^64 - n) mod n;  R^2 mod n  R mod n ƽõ
+    ctx->one = ((uint64)0 - n) % n;
+    ctx->r2 = mul_mod(ctx->one, ctx->one, n);
+}
+
+// REDC:  a * b * R^(-1) mod n
+// ȡ m = t_lo * n^(-1) t - m*n ĵ 64 λΪ 0 64 λΪ (ܲһ n)
+// üʽʡȥӷλжϣ n < 2^64 
+uint64 mont_mul(uint64 a, uint64 b, const MONT_CTX* ctx) {
+    uint64 t_hi, t_lo = mul_64x64(a, b, &t_hi);
+    uint64 m = t_lo * ctx->n_inv;
+    uint64 mn_hi;
+    mul_64x64(m, ctx->n, &mn_hi);
+    uint64 r = t_hi - mn_hi;
+    return (t_hi < mn_hi) ? r + ctx->n : r;
+}
+
+uint64 mont_to(uint64 a, const MONT_CTX* ctx) {
+    return mont_mul(a % ctx->n, ctx->r2, ctx);
+}
+
+uint64 mont_from(uint64 a, const MONT_CTX* ctx) {
+    return mont_mul(a, 1, ctx);
+}
+
+uint64 mont_power(uint64 base, uint64 exponent, const MONT_CTX* ctx) {
+    uint64 result = ctx->one;
+    uint64 b = mont_to(base, ctx);
+    while (exponent > 0) {
+        if (exponent & 1) result = mont_mul(result, b, ctx);
+        exponent >>= 1;
+        b = mont_mul(b, b, ctx);
+    }
+    return mont_from(result, ctx);
+}
+
+// --- ָĶ·ģ ---
+
+// Ԥ 2^w ĴҪʡµĳ˷̯ƽ
+int mont_window_size(uint64 exponent) {
+    int bits = 0;
+    while (exponent >> bits) bits++;
+    if (bits <= 8) return 1;
+    if (bits <= 24) return 2;
+    if (bits <= 48) return 3;
+    return 4;
+}
+
+int mont_split_exponent(uint64 exponent, int w, uint8 digits[64]) {
+    int bits = 0;
+    while (exponent >> bits) bits++;
+    int n = (bits + w - 1) / w;
+    if (n == 0) n = 1; // e = 0 ʱҲһ ( 0)
+    for (int i = 0; i < n; i++) {
+        digits[i] = (uint8)((exponent >> ((n - 1 - i) * w)) & ((1u << w) - 1));
+    }
+    return n;
+}
+
+void mont_power_x4(const MONT_CTX* mont, const uint8* digits, int n_digits, int w,
+                   const uint64 base[MONT_INTERLEAVE], uint64 out[MONT_INTERLEAVE]) {
+    uint64 table[MONT_INTERLEAVE][16];
+    uint64 r[MONT_INTERLEAVE];
+    int size = 1 << w;
+
+    for (int j = 0; j < MONT_INTERLEAVE; j++) {
+        table[j][0] = mont->one;
+        table[j][1] = mont_to(base[j], mont);
+    }
+    for (int i = 2; i < size; i++) {
+        for (int j = 0; j < MONT_INTERLEAVE; j++) table[j][i] = mont_mul(table[j][i - 1], table[j][1], mont);
+    }
+
+    for (int j = 0; j < MONT_INTERLEAVE; j++) r[j] = table[j][digits[0]];
+    for (int i = 1; i < n_digits; i++) {
+        for (int s = 0; s < w; s++) {
+            for (int j = 0; j < MONT_INTERLEAVE; j++) r[j] = mont_mul(r[j], r[j], mont);
+        }
+        uint8 d = digits[i];
+        if (d) {
+            for (int j = 0; j < MONT_INTERLEAVE; j++) r[j] = mont_mul(r[j], table[j][d], mont);
+        }
+    }
+    for (int j = 0; j < MONT_INTERLEAVE; j++) out[j] = mont_from(r[j], mont);
+}
+
+// --- ̶ģ ---
+
+// ȫֻɵ (g, p) 
+#define FIXED_BASE_CACHE_SIZE 32
+
+void fixed_base_init(FIXED_BASE_TABLE* table, uint64 g, uint64 p) {
+    table->g = g;
+    table->p = p;
+    uint64 base = g % p; // ǰڵĵ g^(2^(w*i))
+    for (int i = 0; i < FIXED_BASE_DIGITS; i++) {
+        uint64* row = table->table[i];
+        row[0] = base;
+        for (int d = 1; d < (1 << FIXED_BASE_WINDOW) - 1; d++) row[d] = mul_mod(row[d - 1], base, p);
+        base = mul_mod(row[(1 << FIXED_BASE_WINDOW) - 2], base, p); // g^(2^w * 2^(w*i))
+    }
+}
+
+uint64 fixed_base_power(const FIXED_BASE_TABLE* table, uint64 exponent) {
+    uint64 result = 1 % table->p;
+    for (int i = 0; exponent != 0; i++, exponent >>= FIXED_BASE_WINDOW) {
+        uint32 d = (uint32)(exponent & ((1 << FIXED_BASE_WINDOW) - 1));
+        if (d) result = mul_mod(result, table->table[i][d - 1], table->p);
+    }
+    return result;
+}
+
+// λֻ: ɨѷĲλдڻڽٷ
+static std::atomic<FIXED_BASE_TABLE*> fixed_base_cache[FIXED_BASE_CACHE_SIZE];
+static std::mutex fixed_base_cache_lock;
+
+static const FIXED_BASE_TABLE* fixed_base_find(uint64 g, uint64 p) {
+    for (int i = 0; i < FIXED_BASE_CACHE_SIZE; i++) {
+        const FIXED_BASE_TABLE* t = fixed_base_cache[i].load(std::memory_order_acquire);
+        if (t == nullptr) break;
+        if (t->g == g && t->p == p) return t;
+    }
+    return nullptr;
+}
+
+const FIXED_BASE_TABLE* fixed_base_get(uint64 g, uint64 p) {
+    if (p < 2) return nullptr;
+    g %= p;
+    const FIXED_BASE_TABLE* t = fixed_base_find(g, p);
+    if (t) return t;
+
+    std::lock_guard<std::mutex> lk(fixed_base_cache_lock);
+    t = fixed_base_find(g, p); // ܸ߳̿ոս
+    if (t) return t;
+    for (int i = 0; i < FIXED_BASE_CACHE_SIZE; i++) {
+        if (fixed_base_cache[i].load(std::memory_order_relaxed) == nullptr) {
+            FIXED_BASE_TABLE* table = new FIXED_BASE_TABLE;
+            fixed_base_init(table, g, p);
+            fixed_base_cache[i].store(table, std::memory_order_release);
+            return table;
+        }
+    }
+    return nullptr;
+}
+
+uint64 power_fixed_base(uint64 g, uint64 exponent, uint64 p) {
+    const FIXED_BASE_TABLE* t = fixed_base_get(g, p);
+    return t ? fixed_base_power(t, exponent) : power(g, exponent, p);
+}
+
+// --- ͬʱģ ---
+
+uint64 multi_power(const uint64* bases, const uint64* exponents, int count, uint64 modulus) {
+    if (count <= 0 || count > MULTI_POWER_MAX) return 0;
+    if (count == 1) return power(bases[0], exponents[0], modulus);
+
+    int bits = 0;
+    for (int i = 0; i < count; i++) {
+        int b = 0;
+        while (exponents[i] >> b) b++;
+        if (b > bits) bits = b;
+    }
+    if (bits == 0) return 1 % modulus;
+
+    // ڿȵģ˴:  count * (2^w - 2)ƽ bitsڳ˷ count * bits/w * (1 - 2^-w)
+    int w = 1;
+    double best = 0;
+    for (int cand = 1; cand <= 4; cand++) {
+        double cost = count * ((1 << cand) - 2) + bits + count * ((double)bits / cand) * (1.0 - 1.0 / (1 << cand));
+        if (cand == 1 || cost < best) { best = cost; w = cand; }
+    }
+
+    // ģ (ģ)  Montgomery ˷ÿγ˷һ 128 λ
+    bool use_mont = (modulus & 1) != 0 && modulus > 1;
+    MONT_CTX mont = { 0, 0, 0, 0 };
+    if (use_mont) mont_init(&mont, modulus);
+
+    // table[i][d] = bases[i]^d mod modulus (d = 1 .. 2^w - 1)
+    uint64 table[MULTI_POWER_MAX][16];
+    int size = 1 << w;
+    for (int i = 0; i < count; i++) {
+        table[i][1] = use_mont ? mont_to(bases[i], &mont) : bases[i] % modulus;
+        for (int d = 2; d < size; d++) {
+            table[i][d] = use_mont ? mont_mul(table[i][d - 1], table[i][1], &mont)
+                                   : mul_mod(table[i][d - 1], table[i][1], modulus);
+        }
+    }
+
+    // ߴڿʼ:  w ιƽٳÿǰڵı
+    int windows = (bits + w - 1) / w;
+    uint64 result = use_mont ? mont.one : 1 % modulus;
+    for (int j = windows - 1; j >= 0; j--) {
+        if (j != windows - 1) {
+            for (int s = 0; s < w; s++) {
+                result = use_mont ? mont_mul(result, result, &mont) : mul_mod(result, result, modulus);
+            }
+        }
+        for (int i = 0; i < count; i++) {
+            uint32 d = (uint32)((exponents[i] >> (j * w)) & (size - 1));
+            if (d) result = use_mont ? mont_mul(result, table[i][d], &mont) : mul_mod(result, table[i][d], modulus);
+        }
+    }
+    return use_mont ? mont_from(result, &mont) : result;
+}
+
+// --- й: פ̳߳ ---
+// ߳ڵһεʱ (CPU  - 1 )֮һֱ
+
+namespace {
+
+struct ParallelJob {
+    void (*fn)(size_t, size_t, void*);
+    void* arg;
+    size_t count;
+    size_t chunk;
+    int max_workers;               // ٸ̲߳
+    std::atomic<size_t> next;      // һȡ
+    int refs;                      // ִбĹ߳ ( pool.m )
+};
+
+// ǰ߳Ƿִ parallel_for  (Ƕ׵ʱֱӴִУ)
+static thread_local bool in_parallel_job = false;
+
+static void run_chunks(ParallelJob* job) {
+    bool outer = in_parallel_job;
+    in_parallel_job = true;
+    for (;;) {
+        size_t begin = job->next.fetch_add(job->chunk);
+        if (begin >= job->count) break;
+        size_t end = (begin + job->chunk < job->count) ? begin + job->chunk : job->count;
+        job->fn(begin, end, job->arg);
+    }
+    in_parallel_job = outer;
+}
+
+class ThreadPool {
+public:
+    ThreadPool() : current_(nullptr), generation_(0), stop_(false) {
+        unsigned hw = std::thread::hardware_concurrency();
+        size_t n = (hw > 1) ? hw - 1 : 0;
+        for (size_t i = 0; i < n; i++) {
+            workers_.emplace_back(&ThreadPool::worker_loop, this, (int)i);
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : workers_) t.join();
+    }
+
+    int size() const { return (int)workers_.size(); }
+
+    void run(ParallelJob* job) {
+        std::lock_guard<std::mutex> submit_lk(submit_); // ͬһʱִֻһ
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            current_ = job;
+            generation_++;
+        }
+        cv_.notify_all();
+
+        run_chunks(job); // ߳Ҳ
+
+        // ٽµḶ́߳Ѽ߳ȫ
+        std::unique_lock<std::mutex> lk(m_);
+        current_ = nullptr;
+        done_cv_.wait(lk, [job] { return job->refs == 0; });
+    }
+
+private:
+    void worker_loop(int index) {
+        uint64 seen = 0;
+        for (;;) {
+            ParallelJob* job;
+            {
+                std::unique_lock<std::mutex> lk(m_);
+                cv_.wait(lk, [&] { return stop_ || (current_ != nullptr && generation_ != seen); });
+                if (stop_) return;
+                seen = generation_;
+                job = current_;
+                if (index >= job->max_workers) continue;
+                job->refs++;
+            }
+            run_chunks(job);
+            {
+                std::lock_guard<std::mutex> lk(m_);
+                if (--job->refs == 0) done_cv_.notify_all();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex m_, submit_;
+    std::condition_variable cv_, done_cv_;
+    ParallelJob* current_;
+    uint64 generation_;
+    bool stop_;
+};
+
+static ThreadPool& thread_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+} // namespace
+
+void parallel_for(size_t count, int num_threads, void (*fn)(size_t begin, size_t end, void* arg), void* arg) {
+    if (count == 0) return;
+    if (num_threads == 1 || count == 1 || in_parallel_job) {
+        fn(0, count, arg);
+        return;
+    }
+
+    ThreadPool& pool = thread_pool();
+    int workers = pool.size();
+    if (num_threads > 0 && num_threads - 1 < workers) workers = num_threads - 1;
+    if (workers <= 0) {
+        fn(0, count, arg);
+        return;
+    }
+
+    ParallelJob job;
+    job.fn = fn;
+    job.arg = arg;
+    job.count = count;
+    // ÿ̴߳Լȡ 4 Σ˸ؾȿ
+    job.chunk = count / ((size_t)(workers + 1) * 4);
+    if (job.chunk == 0) job.chunk = 1;
+    job.max_workers = workers;
+    job.next = 0;
+    job.refs = 0;
+    pool.run(&job);
+}
+
+// ---  ---
+
+uint64 random_uint64(void) {
+    // random_device ڸƽ̨ȡϵͳԴ (Windows: RtlGenRandom, Linux: /dev/urandom)
+    static thread_local std::random_device rd;
+    return ((uint64)rd() << 32) ^ (uint64)rd();
+}
+
+void seeded_random_bytes(uint64* state, uint8* out, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+        out[i] = (uint8)(*state >> 56);
+    }
+}
+
+// С (3 ~ 2047)ɸѡеС
+#define SMALL_PRIME_LIMIT 2048
+
+namespace {
+
+struct SmallPrimes {
+    std::vector<uint32> list;
+    SmallPrimes() {
+        std::vector<bool> composite(SMALL_PRIME_LIMIT, false);
+        for (uint32 i = 3; i < SMALL_PRIME_LIMIT; i += 2) {
+            if (composite[i]) continue;
+            list.push_back(i);
+            for (uint32 j = i * i; j < SMALL_PRIME_LIMIT; j += 2 * i) composite[j] = true;
+        }
+    }
+};
+
+static const std::vector<uint32>& small_primes() {
+    static const SmallPrimes table; // C++11 ֲ̬ĳʼ̰߳ȫ
+    return table.list;
+}
+
+} // namespace
+
+bool is_probable_prime(uint64 n) {
+    if (n < 2) return false;
+    for (uint64 p : { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 }) {
+        if (n % p == 0) return n == p;
+    }
+    if (n < 37 * 37) return true;
+
+    // n - 1 = d * 2^s
+    uint64 d = n - 1;
+    int s = 0;
+    while ((d & 1) == 0) { d >>= 1; s++; }
+
+    MONT_CTX mont;
+    mont_init(&mont, n);
+    uint64 one = mont.one;
+    uint64 minus_one = n - mont.one; // -1  Montgomery ʽ
+
+    //  7  n < 2^64 ȷԵж (Jim Sinclair)
+    static const uint64 bases[] = { 2, 325, 9375, 28178, 450775, 9780504, 1795265022 };
+    for (uint64 a : bases) {
+        a %= n;
+        if (a == 0) continue;
+
+        uint64 x = mont_to(mont_power(a, d, &mont), &mont);
+        if (x == one || x == minus_one) continue;
+
+        bool composite = true;
+        for (int r = 1; r < s; r++) {
+            x = mont_mul(x, x, &mont);
+            if (x == minus_one) { composite = false; break; }
+        }
+        if (composite) return false;
+    }
+    return true;
+}
+
+// ÿһ
+#define PRIME_SIEVE_WINDOW 1024
+// ÿೢԵĴ; Χû gcd(e, x - 1) = 1 ʱ
+#define PRIME_SEARCH_MAX_WINDOWS 256
+
+typedef struct {
+    int bits;
+    uint64 e;
+    std::atomic<uint64> found; // ҵ0 ʾδҵ
+} PRIME_SEARCH;
+
+// ѡһλΪ 1  bits λΪ
+// (ˣ˻ǡ 2 * bits λ)
+static uint64 random_prime_start(int bits) {
+    uint64 x = random_uint64();
+    if (bits < 64) x &= ((uint64)1 << bits) - 1;
+    x |= (uint64)3 << (bits - 2);
+    return x | 1;
+}
+
+// һ: 㿪ʼСɸĺ
+// ʣµĺѡ Miller-Rabinһҵһѡ˳
+static void prime_search_lane(size_t begin, size_t end, void* arg) {
+    PRIME_SEARCH* job = (PRIME_SEARCH*)arg;
+    const std::vector<uint32>& primes = small_primes();
+    uint64 limit = (job->bits < 64) ? ((uint64)1 << job->bits) : 0; // 0 ʾ
+    std::vector<uint8> composite(PRIME_SIEVE_WINDOW);
+    (void)begin; (void)end;
+
+    for (int round = 0; round < PRIME_SEARCH_MAX_WINDOWS; round++) {
+        if (job->found.load(std::memory_order_relaxed) != 0) return;
+        uint64 base = random_prime_start(job->bits);
+
+        //  base + 2j кСӵλ (ֻС base Сɸ)
+        std::fill(composite.begin(), composite.end(), (uint8)0);
+        for (uint32 sp : primes) {
+            if (sp >= base) break;
+            uint32 r = (uint32)(base % sp);
+            //  j ʹ base + 2j  0 (mod sp): j  -r * 2^(-1)
+            uint32 j = (uint32)(((uint64)(sp - r) % sp) * ((sp + 1) / 2) % sp);
+            for (; j < PRIME_SIEVE_WINDOW; j += sp) composite[j] = 1;
+        }
+
+        for (uint32 j = 0; j < PRIME_SIEVE_WINDOW; j++) {
+            if (composite[j]) continue;
+            if (job->found.load(std::memory_order_relaxed) != 0) return;
+
+            uint64 x = base + 2 * (uint64)j;
+            if (limit != 0 && x >= limit) break;   // λһ
+            if (x < base) break;                   // 64 λ
+            if (job->e != 0) {
+                // Ҫ gcd(e, x - 1) = 1 e ģ phi ûԪ
+                int64 u, v;
+                if (extended_gcd(job->e, x - 1, &u, &v) != 1) continue;
+            }
+            if (!is_probable_prime(x)) continue;
+
+            uint64 expected = 0;
+            job->found.compare_exchange_strong(expected, x);
+            return;
+        }
+    }
+}
+
+uint64 generate_prime(int bits, uint64 e, int num_threads) {
+    if (bits < 3 || bits > 64) return 0;
+
+    PRIME_SEARCH job;
+    job.bits = bits;
+    job.e = e;
+    job.found = 0;
+
+    int lanes = num_threads;
+    if (lanes <= 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        lanes = (hw > 0) ? (int)hw : 1;
+    }
+    // ÿռһ±̳꣬߳طָͬ߳
+    parallel_for((size_t)lanes, lanes, prime_search_lane, &job);
+    return job.found.load();
+}
+
 // --- λʵ (DES, AES) ---
 uint64 general_permute(uint64 input, const uint8* table, int output_bits) {
     uint64 output = 0;
@@ -74,6 +666,28 @@ void print_hex(const char* label, const uint8* data, size_t len) {
     printf("\n");
 }
 
+static uint8 hex_nibble(char c) {
+    if (c >= '0' && c <= '9') return (uint8)(c - '0');
+    if (c >= 'a' && c <= 'f') return (uint8)(c - 'a' + 10);
+    return (uint8)(c - 'A' + 10);
+}
+
+void hex_to_bytes(const char* hex, uint8* out, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        out[i] = (uint8)((hex_nibble(hex[i * 2]) << 4) | hex_nibble(hex[i * 2 + 1]));
+    }
+}
+
+// --- ʱȽ ---
+// ֽڲ OR һֻһжϣǰ
+bool constant_time_equal(const uint8* a, const uint8* b, size_t len) {
+    uint8 diff = 0;
+    for (size_t i = 0; i < len; i++) {
+        diff |= (uint8)(a[i] ^ b[i]);
+    }
+    return diff == 0;
+}
+
 // =======================================================
 // --- AES ޸ǿʹô (Big Endian) ---
 // =======================================================
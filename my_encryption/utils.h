@@ -21,6 +21,35 @@ typedef int64_t int64;
 typedef uint32_t uint32;
 typedef uint8_t uint8;
 
+// Montgomery ģ (ģ n < 2^64, R = 2^64)
+// ͬһģ´ģʱó˷λÿε % 
+typedef struct {
+    uint64 n;     // ģ (Ϊ)
+    uint64 n_inv; // n^(-1) mod 2^64
+    uint64 r2;    // R^2 mod nת Montgomery ʽ
+    uint64 one;   // R mod n Montgomery ʽ 1
+} MONT_CTX;
+
+// ̶ģݱ: ͬһ (g, p)  g^e mod p ʱʹ
+// table[i][d - 1] = g^(d * 2^(w*i)) mod pg^e ֻ e ÿ w λڶӦıˣ
+// Լ 64/w ģˣҪƽ
+#define FIXED_BASE_WINDOW 4
+#define FIXED_BASE_DIGITS (64 / FIXED_BASE_WINDOW)
+typedef struct {
+    uint64 g;
+    uint64 p;
+    uint64 table[FIXED_BASE_DIGITS][(1 << FIXED_BASE_WINDOW) - 1];
+} FIXED_BASE_TABLE;
+
+// ǩõԤԪ (k, r, k^(-1))
+// DSA: r = (g^k mod p) mod q;  ElGamal: r = g^k mod p;  ECDSA: r = (kG).x mod n
+// k^(-1) 㷨ǩ̵ģ (DSA: q, ElGamal: p-1, ECDSA: n)
+typedef struct {
+    uint64 k;
+    uint64 r;
+    uint64 k_inv;
+} NONCE_TRIPLE;
+
 // --- C ӿʼ ---
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +67,104 @@ uint64 extended_gcd(uint64 a, uint64 b, int64* x, int64* y);
 // 3. ģԪ (Modular Inverse)
 uint64 mod_inverse(uint64 a, uint64 m);
 
+// 4. 64 λģ (a * b mod m)м 128 λ㣬
+uint64 mul_mod(uint64 a, uint64 b, uint64 m);
+
+// 5. 64 λģ (a + b mod m)Ҫ a, b < mm  2^63 ʱ a + b Ҳ
+uint64 add_mod(uint64 a, uint64 b, uint64 m);
+
+// --- Montgomery ģ ( RSA ͬһģµĴģ) ---
+
+// ʼģn Ϊ
+void mont_init(MONT_CTX* ctx, uint64 n);
+// ת / ת Montgomery ʽ: a -> aR mod n, aR -> a
+uint64 mont_to(uint64 a, const MONT_CTX* ctx);
+uint64 mont_from(uint64 a, const MONT_CTX* ctx);
+// Montgomery ģ: Ϊ Montgomery ʽ a * b * R^(-1) mod n
+uint64 mont_mul(uint64 a, uint64 b, const MONT_CTX* ctx);
+// ģ: base Ϊͨʽͨʽ base^exponent mod n
+uint64 mont_power(uint64 base, uint64 exponent, const MONT_CTX* ctx);
+
+// --- ָĶ·ģ ( RSA ǩElGamal ) ---
+
+// һνƽģ·
+#define MONT_INTERLEAVE 4
+
+// ָλѡȡڿ (1 ~ 4)
+int mont_window_size(uint64 exponent);
+// ָ w λһ (λǰ)شڸ
+int mont_split_exponent(uint64 exponent, int w, uint8 digits[64]);
+/**
+ * MONT_INTERLEAVE ·Ĺ̶ģ: out[j] = base[j]^e mod n (Ϊͨʽ)
+ * ·ָͬ ( digits )ÿһ 4 һγ˷˷ˮ߿Ա
+ */
+void mont_power_x4(const MONT_CTX* mont, const uint8* digits, int n_digits, int w,
+                   const uint64 base[MONT_INTERLEAVE], uint64 out[MONT_INTERLEAVE]);
+
+// --- ̶ģ ( DH / ElGamal / DSA Ԫ g ) ---
+
+// : Լ 64 * 2^w / w ģˣֻÿһʹʱִһ
+void fixed_base_init(FIXED_BASE_TABLE* table, uint64 g, uint64 p);
+//  g^exponent mod p
+uint64 fixed_base_power(const FIXED_BASE_TABLE* table, uint64 exponent);
+
+/**
+ * ȡ (g, p) Ӧȫֻʱ
+ * ౣ FIXED_BASE_CACHE_SIZE һͷţصָһֱЧ
+ * ֻڳʹõԪԿñ仯ĵ fixed_base_initռ
+ * @return:  p < 2 ʱ NULL
+ */
+const FIXED_BASE_TABLE* fixed_base_get(uint64 g, uint64 p);
+
+//  power(g, exponent, p) ͬʹû治ʱ˻ power
+uint64 power_fixed_base(uint64 g, uint64 exponent, uint64 p);
+
+// --- ͬʱģ (Shamir / Straus DSAElGamal ǩ) ---
+
+// һϲĵ
+#define MULTI_POWER_MAX 8
+
+/**
+ *  prod(bases[i] ^ exponents[i]) mod modulus
+ *  w λڽеͬһƽ
+ * ʱܴԼΪģݵ 0.6 
+ * @param count:  (1 ~ MULTI_POWER_MAX)
+ */
+uint64 multi_power(const uint64* bases, const uint64* exponents, int count, uint64 modulus);
+
+// --- й ---
+
+/**
+ *  [0, count) гɶΣפ̳߳زִ fn(begin, end, arg)
+ * ̱߳Ҳ㣬жɺŷ
+ * @param num_threads: ʹõ߳ (߳); <= 0 ʾʹȫ CPU 
+ */
+void parallel_for(size_t count, int num_threads, void (*fn)(size_t begin, size_t end, void* arg), void* arg);
+
+// ÿԼΪһ 64 λģݵ (RSA / DH / DSA / ElGamal)ģСڸֵʱֵû̳߳
+#define PARALLEL_MIN_ITEMS 256
+
+// ---  ---
+
+// ϵͳԴ 64 λ
+uint64 random_uint64(void);
+
+// ɸֵαֽ (64 λ LCGÿȡ 8 λ)ͬһ state ֵõͬһУֻɲ
+void seeded_random_bytes(uint64* state, uint8* out, size_t len);
+
+// Miller-Rabin Լ; ʹù̶ 7  64 λȷԵ
+bool is_probable_prime(uint64 n);
+
+/**
+ * һ
+ * Сɸ +  + Miller-Rabin߲Уһҵ˳
+ * @param bits: λ (3 ~ 64)λΪ 1
+ * @param e:  0 ʱҪ gcd(e, p - 1) = 1 (RSA Կָ)
+ * @param num_threads: ߳; <= 0 ʾʹȫ
+ * @return: ; Чÿ߶ PRIME_SEARCH_MAX_WINDOWS ûҵʱ 0
+ */
+uint64 generate_prime(int bits, uint64 e, int num_threads);
+
 // --- λ (DES, AES) ---
 
 /**
@@ -66,6 +193,16 @@ void aes_store_word(uint8* dst, uint32 src);
 
 void print_hex(const char* label, const uint8* data, size_t len);
 
+// ʮַ -> ֽ ()hex  2 * len ַСд
+void hex_to_bytes(const char* hex, uint8* out, size_t len);
+
+/**
+ * ʱȽڴǷ ( MAC / ǩȶԣֹʱ)
+ * ĸֽڲͬʱֻ len й
+ * @return true , false 
+ */
+bool constant_time_equal(const uint8* a, const uint8* b, size_t len);
+
 
 
 